@@ -243,6 +243,11 @@ pal_client_bp(PAL_MEMTRACK OFF
         "Enable PAL memory tracker?"
 )
 
+pal_client_bp(PAL_SYSMEM_CACHE OFF
+    DESC
+        "Cache small system memory blocks freed by PAL instead of returning them to the client's callbacks?"
+)
+
 pal_client_bp(PAL_64BIT_ARCHIVE_FILE_FMT OFF
     DESC
         "DXCP requires 64-bit file archives to allow creation of files >4GB."
@@ -165,6 +165,13 @@ function(pal_compile_definitions TARGET)
             PAL_MEMTRACK=1
         >
     )
+
+    target_compile_definitions(${TARGET} PUBLIC
+        # Interface files change layout depending on this, so it must be public.
+        $<$<BOOL:${PAL_SYSMEM_CACHE}>:
+            PAL_SYSMEM_CACHE=1
+        >
+    )
     target_compile_definitions(${TARGET} PRIVATE
         PAL_DISPLAY_DCC=$<BOOL:$<AND:$<BOOL:${PAL_AMDGPU_BUILD}>,$<BOOL:${PAL_DISPLAY_DCC}>>>)
 
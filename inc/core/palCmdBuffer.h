@@ -2194,6 +2194,27 @@ struct PrimeGpuCacheRange
                                   ///  has no bearing on barrier execution or memory dependencies.
 };
 
+/// Specifies what reads the memory updated by a @ref CmdTemplatePatch.
+enum class CmdTemplatePatchType : uint32
+{
+    UserDataTable = 0, ///< A memory-backed user-data table (e.g., constant buffer) read by the template's shaders.
+    IndirectArgs,      ///< Argument data read by the template's indirect draws and dispatches.
+};
+
+/// Describes one value which @ref ICmdBuffer::CmdExecuteTemplate writes before executing a template command buffer.
+///
+/// The template's commands only contain the address of this memory, so the patched value is read at execution time.
+/// Values written into the command stream itself (e.g., user data set by CmdSetUserData or vertex buffer SRDs) have no
+/// stable location in the template and can't be patched.
+struct CmdTemplatePatch
+{
+    CmdTemplatePatchType type;       ///< What reads the patched memory.
+    const IGpuMemory*    pGpuMemory; ///< GPU memory object holding the table or arguments the template reads.
+    gpusize              offset;     ///< Byte offset into pGpuMemory to patch.  Must be a multiple of 4.
+    gpusize              dataSize;   ///< Amount of data to write, in bytes.  Must be a multiple of 4.
+    const uint32*        pData;      ///< Host data to be written into pGpuMemory.
+};
+
 /// Magic number tag for payloads in command buffer dumps
 constexpr uint32 CmdBufferPayloadSignature = 0x1337F77D;
 
@@ -4533,6 +4554,69 @@ public:
         uint32            cmdBufferCount,
         ICmdBuffer*const* ppCmdBuffers) = 0;
 
+    /// Executes a template: a nested command buffer recorded once, which reads some of its values from memory that is
+    /// patched before each execution.  Each patch is written with @ref CmdUpdateMemory, then the template is executed
+    /// with @ref CmdExecuteNestedCmdBuffers, which launches it or copies its command chunks into this command buffer.
+    /// This is cheaper than recording the template's commands again when only those values change.
+    ///
+    /// This issues a barrier before the patches, so that prior reads of the patched memory complete before it is
+    /// overwritten, and a barrier after them, so that the template reads the new values.
+    ///
+    /// @note All executions of a template read the same memory, so they only see their own patches if they execute in
+    ///       order on one queue.  Other work must not read the patched memory while the template may be executing.
+    ///
+    /// @param [in] pTemplate      Nested command buffer to execute.  See @ref CmdExecuteNestedCmdBuffers.
+    /// @param [in] patchCount     Number of entries in pPatches.
+    /// @param [in] pPatches       Values to write before executing the template.
+    /// @param [in] barrierReason  Reason reported for the barriers around the patches.  See AcquireReleaseInfo::reason.
+    inline void CmdExecuteTemplate(
+        ICmdBuffer*             pTemplate,
+        uint32                  patchCount,
+        const CmdTemplatePatch* pPatches,
+        uint32                  barrierReason)
+    {
+        if (patchCount > 0)
+        {
+            constexpr uint32 ShaderStages = PipelineStageVs | PipelineStageHs | PipelineStageDs | PipelineStageGs |
+                                            PipelineStagePs | PipelineStageCs;
+
+            uint32 readStageMask  = 0;
+            uint32 readAccessMask = 0;
+
+            for (uint32 idx = 0; idx < patchCount; ++idx)
+            {
+                const bool isIndirectArgs = (pPatches[idx].type == CmdTemplatePatchType::IndirectArgs);
+
+                readStageMask  |= isIndirectArgs ? PipelineStageFetchIndirectArgs : ShaderStages;
+                readAccessMask |= isIndirectArgs ? CoherIndirectArgs              : CoherShaderRead;
+            }
+
+            AcquireReleaseInfo barrier  = {};
+            barrier.srcGlobalStageMask  = readStageMask;
+            barrier.dstGlobalStageMask  = PipelineStageBlt;
+            barrier.srcGlobalAccessMask = readAccessMask;
+            barrier.dstGlobalAccessMask = CoherCopyDst;
+            barrier.reason              = barrierReason;
+
+            CmdReleaseThenAcquire(barrier);
+
+            for (uint32 idx = 0; idx < patchCount; ++idx)
+            {
+                CmdUpdateMemory(*pPatches[idx].pGpuMemory, pPatches[idx].offset, pPatches[idx].dataSize,
+                                pPatches[idx].pData);
+            }
+
+            barrier.srcGlobalStageMask  = PipelineStageBlt;
+            barrier.dstGlobalStageMask  = readStageMask;
+            barrier.srcGlobalAccessMask = CoherCopyDst;
+            barrier.dstGlobalAccessMask = readAccessMask;
+
+            CmdReleaseThenAcquire(barrier);
+        }
+
+        CmdExecuteNestedCmdBuffers(1, &pTemplate);
+    }
+
     /// Saves a copy of some set of the current command buffer state that is used by compute workloads. This feature is
     /// intended to give PAL clients a convenient way to issue their own internal compute workloads without modifying
     /// the application-facing state.
@@ -134,6 +134,42 @@ extern void PackRawClearColor(
 /// Swizzles the color according to the provided format swizzle.
 extern void SwizzleColor(SwizzledFormat format, const uint32* pColorIn, uint32* pColorOut);
 
+/// Checks if a row of pixels can be converted between the specified formats with @ref ConvertPixels.
+///
+/// Conversions are supported between any two formats with a regular, byte-aligned per-pixel layout, as long as both
+/// are integer (Uint/Sint) or both are non-integer formats. Block-compressed, macro-pixel-packed, YUV planar and
+/// depth/stencil formats are not supported; the planes of a YUV planar image can be converted individually using
+/// their per-plane formats. Packed YUV channels are treated as unsigned-normalized without color space conversion.
+///
+/// @param [in] srcFormat Format of the source pixels.
+/// @param [in] dstFormat Format of the destination pixels.
+///
+/// @returns True if the conversion is supported, false otherwise.
+extern bool SupportsPixelConversion(
+    SwizzledFormat srcFormat,
+    SwizzledFormat dstFormat);
+
+/// Converts a contiguous row of pixels from one format to another on the CPU.
+///
+/// The source swizzle selects which source component makes up each RGBA channel and the destination swizzle selects
+/// which destination component each RGBA channel is written to, the same way @ref ConvertColor treats its swizzle.
+/// Destination components which no RGBA channel maps to are written as zero.
+///
+/// @param [in]  srcFormat  Format of the source pixels.
+/// @param [in]  pSrc       Source pixels, tightly packed.
+/// @param [in]  dstFormat  Format of the destination pixels.
+/// @param [out] pDst       Destination pixels, tightly packed. Must not overlap pSrc.
+/// @param [in]  pixelCount Number of pixels to convert.
+///
+/// @returns Success if the pixels were converted, ErrorInvalidPointer if pSrc or pDst is null, or ErrorInvalidFormat
+///          if @ref SupportsPixelConversion returns false for the two formats.
+extern Result ConvertPixels(
+    SwizzledFormat srcFormat,
+    const void*    pSrc,
+    SwizzledFormat dstFormat,
+    void*          pDst,
+    uint32         pixelCount);
+
 /// Compares two SwizzledFormats and checks for equality.
 ///
 /// @param lhs [in] Left hand side of comparison
@@ -34,6 +34,9 @@
 #include "pal.h"
 #include "palSysMemory.h"
 #include "palMemTrackerImpl.h"
+#if PAL_SYSMEM_CACHE
+#include "palThreadCachingAllocatorImpl.h"
+#endif
 #include "palDestroyable.h"
 #include "palDeveloperHooks.h"
 
@@ -525,6 +528,8 @@ public:
     {
 #if PAL_MEMTRACK
         return m_memTracker.Alloc(allocInfo);
+#elif PAL_SYSMEM_CACHE
+        return m_cachingAllocator.Alloc(allocInfo);
 #else
         return m_allocator.Alloc(allocInfo);
 #endif
@@ -537,6 +542,8 @@ public:
     {
 #if PAL_MEMTRACK
         m_memTracker.Free(freeInfo);
+#elif PAL_SYSMEM_CACHE
+        m_cachingAllocator.Free(freeInfo);
 #else
         m_allocator.Free(freeInfo);
 #endif
@@ -596,10 +603,17 @@ protected:
     IPlatform(
         const Util::AllocCallbacks& allocCb)
         :
+        m_allocator(allocCb),
+#if PAL_SYSMEM_CACHE
+        m_cachingAllocator(&m_allocator),
+#endif
 #if PAL_MEMTRACK
+#if PAL_SYSMEM_CACHE
+        m_memTracker(&m_cachingAllocator),
+#else
         m_memTracker(&m_allocator),
 #endif
-        m_allocator(allocCb),
+#endif
         m_pClientData(nullptr) { }
 
     /// @internal Destructor. Prevent use of delete operator on this interface.  Client must destroy objects by
@@ -626,14 +640,25 @@ protected:
         Developer::Callback pfnDeveloperCb,
         void*               pPrivateData) = 0;
 
+    /// @internal Memory allocator. Calls to Alloc() and Free() are chained down to the allocator's counterparts.
+    Util::ForwardAllocator m_allocator;
+
+#if PAL_SYSMEM_CACHE
+    /// @internal Caches small blocks freed by PAL so they can be reused without calling the client's callbacks.
+    Util::ThreadCachingAllocator<Util::ForwardAllocator> m_cachingAllocator;
+#endif
+
 #if PAL_MEMTRACK
     /// @internal Memory leak tracker. Requires an allocator in order to perform the actual allocations. We can't
-    /// provide this platform because that would result in a stack overflow. We must give it our forward allocator.
+    /// provide this platform because that would result in a stack overflow. We must give it our forward allocator
+    /// (or the caching layer on top of it). It is declared after both so that it is destroyed first: its destructor
+    /// frees any leaked memory through them.
+#if PAL_SYSMEM_CACHE
+    Util::MemTracker<Util::ThreadCachingAllocator<Util::ForwardAllocator>> m_memTracker;
+#else
     Util::MemTracker<Util::ForwardAllocator> m_memTracker;
 #endif
-
-    /// @internal Memory allocator. Calls to Alloc() and Free() are chained down to the allocator's counterparts.
-    Util::ForwardAllocator m_allocator;
+#endif
 
 private:
     /// @internal Client data pointer. This can have an arbitrary value and can be returned by calling GetClientData()
@@ -28,6 +28,7 @@
 #include "palGpaSession.h"
 #include "palGpuUtil.h"
 #include "palTraceSession.h"
+#include "palFile.h"
 #include "palVector.h"
 #include "palHashSet.h"
 #include "palMutex.h"
@@ -123,11 +124,25 @@ struct CodeObjectCorrelation
     Pal::uint32       reserved         : 31; /// Bitflags reserved for future use
 };
 
+/// "CORef" RDF chunk identifier & version
+constexpr char        CodeObjectRefChunkId[TextIdentifierSize] = "CORef";
+constexpr Pal::uint32 CodeObjectRefChunkVersion                = 1;
+
+/// Header for the "CORef" RDF chunk. The payload is an array of Pal::ShaderHash, one for each code object which was
+/// not embedded in the trace because it was already exported to the code object cache directory by an earlier trace.
+/// Each exported code object is stored in that directory as "<upper><lower>.co", using the 16-digit hexadecimal
+/// representation of each half of its hash.
+struct CodeObjectRefHeader
+{
+    Pal::uint32 pciId; /// The ID of the GPU the trace was run on
+    Pal::uint32 count; /// Number of code object hashes in this chunk
+};
+
 } // namespace TraceChunk
 
 /// CodeObject Trace Source name & version
 constexpr char        CodeObjectTraceSourceName[]  = "codeobject";
-constexpr Pal::uint32 CodeObjectTraceSourceVersion = 3;
+constexpr Pal::uint32 CodeObjectTraceSourceVersion = 4;
 
 // =====================================================================================================================
 class CodeObjectTraceSource : public ITraceSource
@@ -147,7 +162,7 @@ public:
     Pal::Result UnregisterElfBinary(const ElfBinaryInfo& elfBinaryInfo);
 
     // ==== Base Class Overrides =================================================================================== //
-    virtual void OnConfigUpdated(DevDriver::StructuredValue* pJsonConfig) override { }
+    virtual void OnConfigUpdated(DevDriver::StructuredValue* pJsonConfig) override;
 
     virtual Pal::uint64 QueryGpuWorkMask() const override { return 0; }
 
@@ -163,6 +178,9 @@ public:
     virtual const char* GetName()    const override { return CodeObjectTraceSourceName; }
     virtual Pal::uint32 GetVersion() const override { return CodeObjectTraceSourceVersion; }
 
+    // The records are guarded by this source's own locks, so it can be finalized alongside other sources.
+    virtual bool SupportsConcurrentFinish() const override { return true; }
+
 private:
     Pal::Result RegisterSinglePipeline(const Pal::IPipeline* pPipeline, const RegisterPipelineInfo& clientInfo);
     Pal::Result UnregisterSinglePipeline(const Pal::IPipeline* pPipeline);
@@ -177,7 +195,20 @@ private:
         const ElfBinaryInfo&                elfBinaryInfo,
         TraceChunk::CodeObjectLoadEventType eventType);
 
-    Pal::Result WriteCodeObjectChunks();
+    Pal::Result AddPsoCorrelation(
+        Pal::uint64              apiHash,
+        const Pal::PipelineHash& internalPipelineHash,
+        Pal::uint64              uniqueHash);
+
+    Pal::Result RegisterCodeObjectHash(Pal::uint64 hash);
+    Pal::Result AddCodeObjectRecord(
+        Pal::uint64 hash,
+        void*       pCodeObjectRecord);
+
+    using CodeObjectRefList = Util::Vector<Pal::ShaderHash, 64, Pal::IPlatform>;
+
+    Pal::Result WriteCodeObjectChunks(CodeObjectRefList* pRefs);
+    Pal::Result WriteCodeObjectRefChunk(const CodeObjectRefList& refs);
     Pal::Result WriteLoaderEventsChunk();
     Pal::Result WritePsoCorrelationChunk();
     Pal::Result WriteCoCorrelationChunk();
@@ -186,21 +217,52 @@ private:
     {
         Pal::uint32     recordSize;
         Pal::ShaderHash codeObjectHash;
+        Pal::uint32     exportedTrace;  // Value of m_traceIndex when the code object was last found in (or written to)
+                                        // the code object cache directory, or zero if it never was.
     };
 
+    bool IsCodeObjectExported(CodeObjectDatabaseRecord* pRecord) const;
+    void ExportCodeObject(CodeObjectDatabaseRecord* pRecord) const;
+    void GetCodeObjectCachePath(const CodeObjectDatabaseRecord& record, char* pPath, size_t pathSize) const;
+
+    // Code object registration is split into shards keyed by the pipeline hash, so that pipelines created on different
+    // threads rarely contend on the same lock.
+    static constexpr Pal::uint32 NumCodeObjectShards = 8;
+
+    struct CodeObjectShard
+    {
+        CodeObjectShard(Pal::IPlatform* pPlatform) : records(pPlatform), registeredPipelines(512, pPlatform) { }
+
+        Util::RWLock                                                      lock;
+        Util::Vector<CodeObjectDatabaseRecord*, 1, Pal::IPlatform>        records;
+        Util::HashSet<Pal::uint64, Pal::IPlatform, Util::JenkinsHashFunc> registeredPipelines;
+    };
+
+    CodeObjectShard* GetShard(Pal::uint64 hash) { return &m_shards[hash & (NumCodeObjectShards - 1)]; }
+
     Pal::IPlatform* const m_pPlatform;
 
-    Util::RWLock                                                        m_registerPipelineLock;
-    Util::Vector<CodeObjectDatabaseRecord*,         1, Pal::IPlatform>  m_codeObjectRecords;
+    CodeObjectShard                                                     m_shards[NumCodeObjectShards];
+
+    Util::RWLock                                                        m_loadEventLock;
     Util::Vector<TraceChunk::CodeObjectLoadEvent,   1, Pal::IPlatform>  m_loadEventRecords;
+
+    Util::RWLock                                                        m_correlationLock;
     Util::Vector<TraceChunk::PsoCorrelation,        1, Pal::IPlatform>  m_psoCorrelationRecords;
     Util::Vector<TraceChunk::CodeObjectCorrelation, 1, Pal::IPlatform>  m_coCorrelationRecords;
 
     // API hashes -> internal pipeline hash (-> child code object hashes)
     Util::HashSet<Pal::uint64, Pal::IPlatform, Util::JenkinsHashFunc>   m_registeredApiHashes;
-    Util::HashSet<Pal::uint64, Pal::IPlatform, Util::JenkinsHashFunc>   m_registeredPipelines;
     Util::HashSet<Pal::uint64, Pal::IPlatform, Util::JenkinsHashFunc>   m_registeredCoHashes;
 
+    // Optional directory which code objects are exported to. Code objects already present there are referenced by
+    // hash from a "CORef" chunk rather than being embedded in every trace.
+    char                                                                m_codeObjectCacheDir[Util::MaxPathStrLen];
+
+    // Incremented once per trace. The cache directory may change between traces and files in it may be deleted, so
+    // whether a code object is exported is only trusted within the trace in which it was checked.
+    Pal::uint32                                                         m_traceIndex;
+
 };
 
 } // namespace GpuUtil
@@ -305,6 +305,15 @@ public:
     ///
     /// @returns true if multiple instances of this trace sources can co-exist in one session, false otherwise.
     virtual bool AllowMultipleInstances() const { return false; }
+
+    /// Whether OnTraceFinished may be called concurrently with the OnTraceFinished calls of other trace sources
+    ///
+    /// Sources which return true must not depend on the state of other trace sources or on the order in which chunks
+    /// from different sources are written. The session only makes use of this when concurrent finalization has been
+    /// enabled via TraceSession::SetMaxFinishThreads.
+    ///
+    /// @returns true if OnTraceFinished can be called from a session worker thread, false otherwise.
+    virtual bool SupportsConcurrentFinish() const { return false; }
 };
 
 /**
@@ -530,8 +539,28 @@ public:
     /// This function MUST be called after EndTrace. When this function is called, the session will communicate with
     /// all registered trace sources and notify them that all GPU work is complete. This notification is typically
     /// used by sources to retrieve data produced by the GPU and write it into the session's trace data.
+    ///
+    /// If concurrent finalization is enabled, sources which report SupportsConcurrentFinish are notified from up to
+    /// the configured number of worker threads while the remaining sources are notified on the calling thread. This
+    /// function does not return until every source has been notified. The order of the resulting chunks is undefined
+    /// in that case.
     void FinishTrace();
 
+    /// Sets the maximum number of worker threads FinishTrace may use to finalize trace sources concurrently.
+    ///
+    /// Concurrent finalization is disabled by default. It may only be changed while no trace is in progress.
+    ///
+    /// @param [in] maxThreads Maximum number of worker threads, in addition to the calling thread. Zero disables
+    ///                        concurrent finalization. Clamped to MaxFinishThreads.
+    void SetMaxFinishThreads(Pal::uint32 maxThreads)
+    {
+        PAL_ASSERT(TraceSessionState::Ready == GetTraceSessionState());
+        m_maxFinishThreads = Util::Min(maxThreads, MaxFinishThreads);
+    }
+
+    /// Upper limit on the number of worker threads used by FinishTrace.
+    static constexpr Pal::uint32 MaxFinishThreads = 8;
+
     /// Writes a chunk of trace data into the session.
     ///
     /// Trace sources are expected to call this function whenever they produce a new data chunk that should be added
@@ -622,6 +651,8 @@ public:
 private:
     typedef Pal::IPlatform TraceAllocator;
 
+    static void FinishTraceWorker(void* pParameter);
+
     Pal::IPlatform* const         m_pPlatform; // Platform associated with this TraceSesion
     DevDriver::IStructuredReader* m_pReader;   // Stores the current JSON-based config of the TraceSession
 
@@ -662,5 +693,6 @@ private:
     size_t              m_configDataSize;    // Size of the cached trace config buffer
     bool                m_cancelingTrace;    // Indicates that a cancel signal has been received and trace cancelation
                                              // is in progress.
+    Pal::uint32         m_maxFinishThreads;  // Worker threads FinishTrace may use to finalize sources concurrently.
 };
 } // GpuUtil
@@ -0,0 +1,70 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palAllocShard.h
+ * @brief PAL utility helpers shared by the sharded allocators (MemTracker and ThreadCachingAllocator).
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+
+#include <atomic>
+
+namespace Util
+{
+
+// Forward declarations
+enum SystemAllocType : uint32;
+
+/// Number of entries in statistics arrays indexed by AllocTypeStatsIndex(): one per SystemAllocType, plus one for
+/// unknown types.
+constexpr uint32 NumAllocTypeStats = 5;
+
+/// Maps an allocation type to its index in statistics arrays.  The last index collects any unknown allocation type.
+///
+/// @param [in] allocType Allocation type of the allocation being counted.
+///
+/// @returns (allocType - AllocObject), or (NumAllocTypeStats - 1) if allocType is not one of PAL's types.
+inline uint32 AllocTypeStatsIndex(SystemAllocType allocType);
+
+/// Returns the shard the calling thread uses in an allocator split into numShards independently locked shards.
+/// Threads are numbered round-robin the first time they call this, so consecutive threads use different shards.
+///
+/// @param [in] numShards Number of shards.
+///
+/// @returns The shard index, less than numShards.
+inline uint32 CurrentThreadShardIndex(
+    uint32 numShards)
+{
+    static std::atomic<uint32> nextThread(0);
+    thread_local const uint32  threadIndex = nextThread.fetch_add(1, std::memory_order_relaxed);
+
+    return (threadIndex % numShards);
+}
+
+} // Util
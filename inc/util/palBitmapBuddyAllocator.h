@@ -0,0 +1,198 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palBitmapBuddyAllocator.h
+ * @brief PAL utility BitmapBuddyAllocator class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Bitmap Buddy Allocator
+ *
+ * Responsible for managing small GPU memory requests by allocating a large base allocation and dividing it into
+ * appropriately sized suballocation blocks. It has the same interface and claim semantics as @ref BuddyAllocator.
+ *
+ * Instead of hash sets of free block offsets, every level of the buddy tree has a free bitmap with one bit per block,
+ * plus a summary bitmap with one bit per non-empty free bitmap word. Another bitmap records which levels hold a free
+ * block. Each splittable level also has a split bitmap, so a block's size can be recovered from its offset by walking
+ * down the tree. Allocate, Free, merging, and the free-space queries all cost O(levels) bit operations. The bitmaps
+ * live in a single system memory allocation made by Init(); no per-block metadata is ever allocated.
+ ***********************************************************************************************************************
+ */
+template <typename Allocator>
+class BitmapBuddyAllocator
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in]  pAllocator     The allocator that will allocate memory if required.
+    /// @param [in]  baseAllocSize  The size of the base allocation this buddy allocator suballocates.
+    /// @param [in]  minAllocSize   The size of the smallest block this buddy allocator can allocate.
+    BitmapBuddyAllocator(
+        Allocator* pAllocator,
+        gpusize    baseAllocSize,
+        gpusize    minAllocSize);
+    ~BitmapBuddyAllocator();
+
+    /// Initializes the buddy allocator.
+    ///
+    /// @returns Success if the buddy allocator has been successfully initialized.
+    Result Init();
+
+    /// Suballocates a block from the base allocation that this buddy allocator manages. Has the same contract as
+    /// @ref BuddyAllocator::Allocate, so @ref ClaimGpuMemory must be called directly before it.
+    ///
+    /// @param [in]  size           The size of the requested suballocation.
+    /// @param [in]  alignment      The alignment requirements of the requested suballocation.
+    /// @param [out] pOffset        The offset the suballocated block starts within the base allocation.
+    ///
+    /// @returns Success if the allocation succeeded, or @ref ErrorOutOfGpuMemory if there isn't a large enough block
+    ///          free in the base allocation to fulfill the request.
+    Result Allocate(
+        gpusize  size,
+        gpusize  alignment,
+        gpusize* pOffset);
+
+    /// Frees a previously allocated suballocation.
+    ///
+    /// @param [in]  offset         The offset the suballocated block starts within the base allocation.
+    /// @param [in]  size           Optional parameter specifying the size of the original allocation.
+    /// @param [in]  alignment      Optional parameter specifying the alignment of the original allocation.
+    void Free(
+        gpusize offset,
+        gpusize size = 0,
+        gpusize alignment = 0);
+
+    /// Tells whether the base allocation is completely free. If the returned value is true then the caller is safe
+    /// to deallocate the base allocation.
+    bool IsEmpty() const
+    {
+        return (m_numSuballocations == 0);
+    }
+
+    /// Returns the size of the largest allocation that can be suballocated with this buddy allocator.
+    gpusize MaximumAllocationSize() const;
+
+    /// Returns the size of the largest block which is currently free, or zero if nothing is free. Unlike
+    /// @ref CheckIfOpenMemory this ignores outstanding claims.
+    gpusize LargestFreeBlockSize() const;
+
+    /// Claims (doesn't allocate) some memory, used to quickly determine if a pool of memory has availible memory.
+    /// Doesn't affect internal state unless Result::Success is returned. See @ref BuddyAllocator::ClaimGpuMemory.
+    ///
+    /// @param [in]  size           The size of the requested suballocation.
+    /// @param [in]  alignment      The alignment requirements of the requested suballocation.
+    ///
+    /// @returns Success if there is enough memory in this buddyAllocator to allocate the requested size of memory,
+    ///          @ref ErrorOutOfGpuMemory if there is not enough memory
+    Result ClaimGpuMemory(
+        gpusize size,
+        gpusize alignment);
+
+    /// Checks if @ref ClaimGpuMemory can actually claim memory, can be used to find the best fit pool. This function
+    /// does NOT acquire a lock and does NOT claim or allocate the memory.
+    ///
+    /// @param [in]  size           The size of the requested suballocation.
+    /// @param [in]  alignment      The alignment requirements of the requested suballocation.
+    /// @param [out] pKval          The highest kval that will need to be split will be stored here.
+    ///
+    /// @returns Success if there is enough memory in this buddyAllocator to allocate the requested size of memory,
+    ///          @ref ErrorOutOfGpuMemory if there is not enough memory
+    Result CheckIfOpenMemory(
+        gpusize size,
+        gpusize alignment,
+        uint32* pKval);
+
+    /// Returns the number of bytes of system memory used for this allocator's bitmaps.
+    size_t MetadataSize() const { return (m_numWords * sizeof(uint64)); }
+
+private:
+    static constexpr uint32 MaxLevels = 64;
+
+    static constexpr gpusize KvalToSize(uint32 kVal) { return (1ull << kVal); }
+
+    static uint32 SizeToKval(gpusize size) { return Log2(size); }
+
+    uint32 RequestLevel(gpusize size, gpusize alignment) const;
+
+    bool   IsFree(uint32 level, gpusize block) const;
+    void   SetFree(uint32 level, gpusize block);
+    void   ClearFree(uint32 level, gpusize block);
+    gpusize FindFree(uint32 level);
+
+    bool   IsSplit(uint32 level, gpusize block) const;
+    void   SetSplit(uint32 level, gpusize block, bool split);
+
+    void   AddAvailable(uint32 level);
+    void   RemoveAvailable(uint32 level);
+
+    Allocator* const    m_pAllocator;
+
+    const uint32        m_baseAllocKval;
+    const uint32        m_minKval;
+    const uint32        m_numLevels;       // Level i holds blocks of kval (m_minKval + i).
+
+    uint64*             m_pWords;          // Storage for every bitmap below.
+    uint32              m_numWords;
+
+    // Per-level offsets into m_pWords of the free, summary and split bitmaps. Level 0 blocks can't be split so it
+    // has no split bitmap.
+    uint32              m_freeOffset[MaxLevels];
+    uint32              m_summaryOffset[MaxLevels];
+    uint32              m_splitOffset[MaxLevels];
+    uint32              m_summaryHint[MaxLevels];  // No summary word below this index has a bit set.
+    uint32              m_numFree[MaxLevels];      // Number of free blocks at each level.
+    uint64              m_freeLevels;              // Bit i is set if level i has a free block.
+
+    // Claim bookkeeping, which mirrors BuddyAllocator's m_pNumFreeList: the number of free blocks at each level once
+    // all outstanding claims have been allocated.
+    uint32              m_numAvailable[MaxLevels];
+    uint64              m_availableLevels;         // Bit i is set if m_numAvailable[i] is nonzero.
+
+    uint32              m_numSuballocations;
+
+    // Set to true if ClaimGpuMemory is ever called on this buddyAllocator.  This signals to free to not merge blocks
+    // if m_numAvailable[level] = 0
+    bool                m_usedClaim;
+
+    // Every operation is a short walk over the levels so a single lock protects all of the above.
+    Util::Mutex         m_lock;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(BitmapBuddyAllocator);
+    PAL_DISALLOW_DEFAULT_CTOR(BitmapBuddyAllocator);
+};
+
+} // Util
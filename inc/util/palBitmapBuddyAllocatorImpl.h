@@ -0,0 +1,474 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palBitmapBuddyAllocatorImpl.h
+ * @brief PAL utility BitmapBuddyAllocator class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palBitmapBuddyAllocator.h"
+#include "palSysMemory.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template <typename Allocator>
+BitmapBuddyAllocator<Allocator>::BitmapBuddyAllocator(
+    Allocator* pAllocator,
+    gpusize    baseAllocSize,
+    gpusize    minAllocSize)
+    :
+    m_pAllocator(pAllocator),
+    m_baseAllocKval(SizeToKval(baseAllocSize)),
+    m_minKval(SizeToKval(minAllocSize)),
+    m_numLevels(m_baseAllocKval - m_minKval),
+    m_pWords(nullptr),
+    m_numWords(0),
+    m_freeOffset{},
+    m_summaryOffset{},
+    m_splitOffset{},
+    m_summaryHint{},
+    m_numFree{},
+    m_freeLevels(0),
+    m_numAvailable{},
+    m_availableLevels(0),
+    m_numSuballocations(0),
+    m_usedClaim(false)
+{
+    // Allocator must be non-null
+    PAL_ASSERT(m_pAllocator != nullptr);
+
+    // Base allocation size must be POT
+    PAL_ASSERT(KvalToSize(m_baseAllocKval) == baseAllocSize);
+
+    // Minimum allocation size must be POT
+    PAL_ASSERT(KvalToSize(m_minKval) == minAllocSize);
+
+    PAL_ASSERT((m_numLevels > 0) && (m_numLevels < MaxLevels));
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+BitmapBuddyAllocator<Allocator>::~BitmapBuddyAllocator()
+{
+    // lock this here to ensure no other thread was doing anything with the buddyAllocator when the destructor is called
+    MutexAuto lock(&m_lock);
+
+    PAL_SAFE_FREE(m_pWords, m_pAllocator);
+}
+
+// =====================================================================================================================
+// Gets maximum allocation size supported by this buddy allocator.
+template <typename Allocator>
+gpusize BitmapBuddyAllocator<Allocator>::MaximumAllocationSize() const
+{
+    // NOTE: Report one less than our base allocation k-value because there's no sense in suballocating a memory
+    // request which is larger than half a chunk
+    return KvalToSize(m_baseAllocKval - 1);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+gpusize BitmapBuddyAllocator<Allocator>::LargestFreeBlockSize() const
+{
+    uint32 level = 0;
+    return BitMaskScanReverse(&level, m_freeLevels) ? KvalToSize(m_minKval + level) : 0;
+}
+
+// =====================================================================================================================
+// Initializes the buddy allocator.
+template <typename Allocator>
+Result BitmapBuddyAllocator<Allocator>::Init()
+{
+    PAL_ASSERT(m_pWords == nullptr);
+
+    Result result = Result::Success;
+
+    // Lay out all of the bitmaps in one allocation. The top level has two blocks and each level below has twice as many
+    // blocks as the level above it.
+    uint32 numWords = 0;
+    for (uint32 level = 0; level < m_numLevels; ++level)
+    {
+        const gpusize numBlocks    = gpusize(2) << (m_numLevels - 1 - level);
+        const uint32  bitmapWords  = static_cast<uint32>(RoundUpQuotient<gpusize>(numBlocks, 64));
+        const uint32  summaryWords = RoundUpQuotient(bitmapWords, 64u);
+
+        m_freeOffset[level]    = numWords;
+        numWords              += bitmapWords;
+        m_summaryOffset[level] = numWords;
+        numWords              += summaryWords;
+
+        if (level > 0)
+        {
+            m_splitOffset[level] = numWords;
+            numWords            += bitmapWords;
+        }
+    }
+
+    m_pWords = static_cast<uint64*>(PAL_CALLOC(numWords * sizeof(uint64), m_pAllocator, AllocInternal));
+
+    if (m_pWords != nullptr)
+    {
+        m_numWords = numWords;
+
+        // We need to create the first two largest-size blocks and add them to the top level.
+        const uint32 topLevel = m_numLevels - 1;
+
+        SetFree(topLevel, 0);
+        SetFree(topLevel, 1);
+        m_numAvailable[topLevel] = 2;
+        m_availableLevels        = (uint64(1) << topLevel);
+    }
+    else
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+
+    PAL_ALERT(result != Result::Success);
+    return result;
+}
+
+// =====================================================================================================================
+// Pads the requested allocation size to the nearest POT of the size and alignment and returns its level.
+template <typename Allocator>
+uint32 BitmapBuddyAllocator<Allocator>::RequestLevel(
+    gpusize size,
+    gpusize alignment
+    ) const
+{
+    const uint32 kval = Max(SizeToKval(Pow2Pad(Max(size, alignment))), m_minKval);
+    PAL_ASSERT((kval >= m_minKval) && (kval < m_baseAllocKval));
+
+    return (kval - m_minKval);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+bool BitmapBuddyAllocator<Allocator>::IsFree(
+    uint32  level,
+    gpusize block
+    ) const
+{
+    return BitfieldIsSet(m_pWords[m_freeOffset[level] + (block >> 6)], (block & 63));
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::SetFree(
+    uint32  level,
+    gpusize block)
+{
+    const uint32 word = static_cast<uint32>(block >> 6);
+
+    PAL_ASSERT(IsFree(level, block) == false);
+
+    m_pWords[m_freeOffset[level] + word]           |= (uint64(1) << (block & 63));
+    m_pWords[m_summaryOffset[level] + (word >> 6)] |= (uint64(1) << (word & 63));
+
+    m_summaryHint[level] = Min(m_summaryHint[level], word >> 6);
+    m_numFree[level]++;
+    m_freeLevels |= (uint64(1) << level);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::ClearFree(
+    uint32  level,
+    gpusize block)
+{
+    const uint32 word = static_cast<uint32>(block >> 6);
+
+    PAL_ASSERT(IsFree(level, block));
+
+    uint64*const pWord = &m_pWords[m_freeOffset[level] + word];
+    *pWord &= ~(uint64(1) << (block & 63));
+
+    if (*pWord == 0)
+    {
+        m_pWords[m_summaryOffset[level] + (word >> 6)] &= ~(uint64(1) << (word & 63));
+    }
+
+    if (--m_numFree[level] == 0)
+    {
+        m_freeLevels &= ~(uint64(1) << level);
+    }
+}
+
+// =====================================================================================================================
+// Returns the lowest free block at the given level, which must have at least one free block.
+template <typename Allocator>
+gpusize BitmapBuddyAllocator<Allocator>::FindFree(
+    uint32 level)
+{
+    PAL_ASSERT(m_numFree[level] > 0);
+
+    const uint64* pSummary = &m_pWords[m_summaryOffset[level]];
+    uint32        sumIdx   = m_summaryHint[level];
+
+    // The hint only moves forward between SetFree calls, so this loop is amortized over the blocks it skips.
+    while (pSummary[sumIdx] == 0)
+    {
+        sumIdx++;
+    }
+
+    m_summaryHint[level] = sumIdx;
+
+    uint32 bit = 0;
+    BitMaskScanForward(&bit, pSummary[sumIdx]);
+
+    const uint32 word = (sumIdx << 6) + bit;
+    BitMaskScanForward(&bit, m_pWords[m_freeOffset[level] + word]);
+
+    return (gpusize(word) << 6) + bit;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+bool BitmapBuddyAllocator<Allocator>::IsSplit(
+    uint32  level,
+    gpusize block
+    ) const
+{
+    return (level > 0) && BitfieldIsSet(m_pWords[m_splitOffset[level] + (block >> 6)], (block & 63));
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::SetSplit(
+    uint32  level,
+    gpusize block,
+    bool    split)
+{
+    PAL_ASSERT(level > 0);
+
+    uint64*const pWord = &m_pWords[m_splitOffset[level] + (block >> 6)];
+
+    if (split)
+    {
+        *pWord |= (uint64(1) << (block & 63));
+    }
+    else
+    {
+        *pWord &= ~(uint64(1) << (block & 63));
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::AddAvailable(
+    uint32 level)
+{
+    m_numAvailable[level]++;
+    m_availableLevels |= (uint64(1) << level);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::RemoveAvailable(
+    uint32 level)
+{
+    PAL_ASSERT_MSG(m_numAvailable[level] > 0,
+                   "This should only fail if ClaimGpuMemory() is not called before every call to Allocate().");
+
+    if (--m_numAvailable[level] == 0)
+    {
+        m_availableLevels &= ~(uint64(1) << level);
+    }
+}
+
+// =====================================================================================================================
+// Suballocates a block from the base allocation that this buddy allocator manages. If no free space is found then an
+// appropriate error is returned.
+// In order for the claim bookkeeping to be correct, ClaimGpuMemory MUST be called directly before this call to
+// Allocate.  The buddyAllocator will still work without this, but the results of ClaimGpuMemory will not be correct.
+template <typename Allocator>
+Result BitmapBuddyAllocator<Allocator>::Allocate(
+    gpusize  size,
+    gpusize  alignment,
+    gpusize* pOffset)
+{
+    PAL_ASSERT(m_pWords != nullptr);
+    PAL_ASSERT(pOffset != nullptr);
+    PAL_ASSERT(size <= MaximumAllocationSize());
+
+    const uint32 level = RequestLevel(size, alignment);
+
+    MutexAuto lock(&m_lock);
+
+    // Find the smallest level at or above the requested one with a free block.
+    uint32 freeLevel = 0;
+    Result result    = BitMaskScanForward(&freeLevel, m_freeLevels & ~((uint64(1) << level) - 1)) ?
+                       Result::Success : Result::ErrorOutOfGpuMemory;
+
+    if (result == Result::Success)
+    {
+        gpusize block = FindFree(freeLevel);
+        ClearFree(freeLevel, block);
+
+        // Split the block down to the requested level, freeing the upper buddy at each level on the way.
+        for (; freeLevel > level; --freeLevel)
+        {
+            SetSplit(freeLevel, block, true);
+
+            block <<= 1;
+            SetFree(freeLevel - 1, block + 1);
+        }
+
+        *pOffset = block << (m_minKval + level);
+
+        // Increment the number of suballocations this buddy allocator manages
+        m_numSuballocations++;
+    }
+
+    PAL_ALERT_MSG(result != Result::Success,
+                  "This should only fail if ClaimGpuMemory() is not called before this call to Allocate().");
+    return result;
+}
+
+// =====================================================================================================================
+// Frees a suballocated block making it available for future re-use.
+template <typename Allocator>
+void BitmapBuddyAllocator<Allocator>::Free(
+    gpusize offset,
+    gpusize size,
+    gpusize alignment)
+{
+    PAL_ASSERT(m_pWords != nullptr);
+
+    MutexAuto lock(&m_lock);
+
+    // Walk down the split bits to find the block which starts at this offset. The first unsplit block on the way down
+    // is the allocation.
+    uint32  level = m_numLevels - 1;
+    gpusize block = offset >> (m_minKval + level);
+
+    while (IsSplit(level, block))
+    {
+        level--;
+        block = offset >> (m_minKval + level);
+    }
+
+    // The offset must point at the start of an allocated block.
+    PAL_ASSERT((block << (m_minKval + level)) == offset);
+    PAL_ASSERT(IsFree(level, block) == false);
+
+    // Merge with our buddy as long as it's also free. We don't want merge if we are on the top level. We also don't
+    // want to merge if a call to claim was made that claimed the buddy we are about to free.
+    while ((level < (m_numLevels - 1))   &&
+           IsFree(level, block ^ 1)      &&
+           ((m_numAvailable[level] > 0) || (m_usedClaim == false)))
+    {
+        ClearFree(level, block ^ 1);
+
+        if (m_numAvailable[level] > 0)
+        {
+            RemoveAvailable(level);
+        }
+
+        level++;
+        block >>= 1;
+        SetSplit(level, block, false);
+    }
+
+    SetFree(level, block);
+    AddAvailable(level);
+
+    // Decrement the number of suballocations this buddy allocator manages
+    PAL_ASSERT(m_numSuballocations > 0);
+    m_numSuballocations--;
+}
+
+// =====================================================================================================================
+// Claims the memory that will be used when Allocate is called.
+// Returns ErrorOutOfGpuMemory if this buddyAllocator has no free blocks, otherwise returns Success.
+template <typename Allocator>
+Result BitmapBuddyAllocator<Allocator>::ClaimGpuMemory(
+    gpusize size,
+    gpusize alignment)
+{
+    // Set this to true as soon as the first call to claim is done to signal to Free that claim is being used.
+    m_usedClaim = true;
+
+    PAL_ASSERT(m_pWords != nullptr);
+
+    const uint32 level    = RequestLevel(size, alignment);
+    const uint64 aboveMask = ~((uint64(1) << level) - 1);
+
+    Result result = Result::ErrorOutOfGpuMemory;
+
+    // Do this check twice to avoid taking the lock at all if we have no chance of Claiming the memory.
+    if ((m_availableLevels & aboveMask) != 0)
+    {
+        MutexAuto lock(&m_lock);
+
+        uint32 claimLevel = 0;
+        if (BitMaskScanForward(&claimLevel, m_availableLevels & aboveMask))
+        {
+            result = Result::Success;
+
+            // We'll split the claimed block down to the requested level, which adds one buddy to each level on the way.
+            for (uint32 splitLevel = level; splitLevel < claimLevel; ++splitLevel)
+            {
+                AddAvailable(splitLevel);
+            }
+
+            RemoveAvailable(claimLevel);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Used to search through pools before claiming memory to find the one that will fragment the least.  pKval will have
+// be the highest level needed to be split up for this pool, so the pool with the lowest value will be best.  Can NOT
+// guarantee the memory will still be availible by the time this thread calls ClaimGpuMemory.
+template <typename Allocator>
+Result BitmapBuddyAllocator<Allocator>::CheckIfOpenMemory(
+    gpusize size,
+    gpusize alignment,
+    uint32* pKval)
+{
+    PAL_ASSERT(m_pWords != nullptr);
+
+    const uint32 level = RequestLevel(size, alignment);
+
+    uint32 claimLevel = 0;
+    Result result     = BitMaskScanForward(&claimLevel, m_availableLevels & ~((uint64(1) << level) - 1)) ?
+                        Result::Success : Result::ErrorOutOfGpuMemory;
+
+    if ((result == Result::Success) && (pKval != nullptr))
+    {
+        *pKval = m_minKval + claimLevel;
+    }
+
+    return result;
+}
+
+} // Util
@@ -0,0 +1,189 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palConcurrentRing.h
+ * @brief PAL utility collection MpmcRing and SpscRing class declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palAssert.h"
+#include "palSysMemory.h"
+
+#include <atomic>
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Bounded, lock-free multi-producer multi-consumer FIFO queue.
+ *
+ * Any number of threads may call TryPush() and TryPop() concurrently.  The storage is a power-of-two sized array of
+ * slots, each with a sequence number which tells producers and consumers whose turn it is to use the slot, so the only
+ * contended operations are one compare-exchange on the head or tail index per call.  Neither operation blocks: TryPush
+ * fails if the ring is full and TryPop fails if it is empty.
+ *
+ * This is meant to replace a Deque guarded by a Mutex for cross-thread hand-offs where an upper bound on the number of
+ * queued items is known.
+ ***********************************************************************************************************************
+ */
+template<typename T, typename Allocator>
+class MpmcRing
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    MpmcRing(Allocator*const pAllocator);
+
+    /// Destroys any elements left in the ring and frees its storage.  No other thread may be using the ring.
+    ~MpmcRing();
+
+    /// Allocates the storage of the ring.
+    ///
+    /// @param [in] capacity Minimum number of elements the ring can hold; rounded up to a power of two.
+    ///
+    /// @returns Success if the storage was allocated, ErrorOutOfMemory otherwise.
+    Result Init(uint32 capacity);
+
+    /// Appends an element to the ring.
+    ///
+    /// @param [in] data Element to copy or move into the ring.
+    ///
+    /// @returns True if the element was added, false if the ring was full.
+    bool TryPush(const T& data) { return Emplace(data); }
+    bool TryPush(T&& data)      { return Emplace(Move(data)); }
+
+    /// Removes the oldest element from the ring.
+    ///
+    /// @param [out] pData Receives the element, which is move-assigned to it.
+    ///
+    /// @returns True if an element was removed, false if the ring was empty.
+    bool TryPop(T* pData);
+
+    /// Returns the number of elements the ring can hold.
+    uint32 Capacity() const { return m_mask + 1; }
+
+    /// Returns the number of elements in the ring.  This is only a snapshot while other threads are using the ring.
+    uint32 NumElements() const;
+
+private:
+    template<typename U>
+    bool Emplace(U&& data);
+
+    // This is a POD-type that exactly fits one T value.
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type ValueStorage;
+
+    struct Slot
+    {
+        std::atomic<uint32> sequence;  // Equal to the position a producer may write, or position + 1 once readable.
+        ValueStorage        value;     // The element, if the slot is readable.
+    };
+
+    Allocator*const m_pAllocator;  // Allocator for the slot array.
+    Slot*           m_pSlots;      // Slot array.
+    uint32          m_mask;        // Capacity - 1.
+
+    // The producer and consumer positions are on separate cache lines so that producers and consumers do not
+    // invalidate each other's caches.
+    alignas(PAL_CACHE_LINE_BYTES) std::atomic<uint32> m_tail;  // Position the next element will be pushed at.
+    alignas(PAL_CACHE_LINE_BYTES) std::atomic<uint32> m_head;  // Position the next element will be popped from.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(MpmcRing);
+    PAL_DISALLOW_DEFAULT_CTOR(MpmcRing);
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Bounded, wait-free single-producer single-consumer FIFO queue.
+ *
+ * A cheaper alternative to MpmcRing when exactly one thread pushes and exactly one (other) thread pops.  Each side
+ * owns its position and keeps a cached copy of the other side's, so the shared positions are only read when the ring
+ * appears full or empty.
+ ***********************************************************************************************************************
+ */
+template<typename T, typename Allocator>
+class SpscRing
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    SpscRing(Allocator*const pAllocator);
+
+    /// Destroys any elements left in the ring and frees its storage.  No other thread may be using the ring.
+    ~SpscRing();
+
+    /// Allocates the storage of the ring.
+    ///
+    /// @param [in] capacity Minimum number of elements the ring can hold; rounded up to a power of two.
+    ///
+    /// @returns Success if the storage was allocated, ErrorOutOfMemory otherwise.
+    Result Init(uint32 capacity);
+
+    /// Appends an element to the ring.  Must only be called by the producer thread.
+    ///
+    /// @param [in] data Element to copy or move into the ring.
+    ///
+    /// @returns True if the element was added, false if the ring was full.
+    bool TryPush(const T& data) { return Emplace(data); }
+    bool TryPush(T&& data)      { return Emplace(Move(data)); }
+
+    /// Removes the oldest element from the ring.  Must only be called by the consumer thread.
+    ///
+    /// @param [out] pData Receives the element, which is move-assigned to it.
+    ///
+    /// @returns True if an element was removed, false if the ring was empty.
+    bool TryPop(T* pData);
+
+    /// Returns the number of elements the ring can hold.
+    uint32 Capacity() const { return m_mask + 1; }
+
+    /// Returns the number of elements in the ring.  This is only a snapshot while other threads are using the ring.
+    uint32 NumElements() const
+        { return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire); }
+
+private:
+    template<typename U>
+    bool Emplace(U&& data);
+
+    Allocator*const m_pAllocator;  // Allocator for the element array.
+    T*              m_pData;       // Element array.
+    uint32          m_mask;        // Capacity - 1.
+
+    // Each side's position and its cached copy of the other side's position share a cache line.
+    alignas(PAL_CACHE_LINE_BYTES) std::atomic<uint32> m_tail;        // Position the next element will be pushed at.
+    uint32                                            m_cachedHead;  // Producer's copy of m_head.
+    alignas(PAL_CACHE_LINE_BYTES) std::atomic<uint32> m_head;        // Position the next element will be popped from.
+    uint32                                            m_cachedTail;  // Consumer's copy of m_tail.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(SpscRing);
+    PAL_DISALLOW_DEFAULT_CTOR(SpscRing);
+};
+
+} // Util
@@ -0,0 +1,312 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palConcurrentRingImpl.h
+ * @brief PAL utility collection MpmcRing and SpscRing class implementations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConcurrentRing.h"
+#include "palInlineFuncs.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+MpmcRing<T, Allocator>::MpmcRing(
+    Allocator*const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_pSlots(nullptr),
+    m_mask(0),
+    m_tail(0),
+    m_head(0)
+{
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+MpmcRing<T, Allocator>::~MpmcRing()
+{
+    if (m_pSlots != nullptr)
+    {
+        // Destroy every element which was pushed but never popped.
+        const uint32 tail = m_tail.load(std::memory_order_acquire);
+
+        for (uint32 pos = m_head.load(std::memory_order_acquire); pos != tail; ++pos)
+        {
+            reinterpret_cast<T*>(&m_pSlots[pos & m_mask].value)->~T();
+        }
+
+        PAL_FREE(m_pSlots, m_pAllocator);
+    }
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result MpmcRing<T, Allocator>::Init(
+    uint32 capacity)
+{
+    PAL_ASSERT((m_pSlots == nullptr) && (capacity <= (1u << 31)));
+
+    const uint32 numSlots = Pow2Pad(Max(capacity, 2u));
+
+    Result result = Result::ErrorOutOfMemory;
+
+    m_pSlots = static_cast<Slot*>(PAL_MALLOC(sizeof(Slot) * numSlots, m_pAllocator, AllocInternal));
+
+    if (m_pSlots != nullptr)
+    {
+        // A slot is writable by the producer whose position equals its sequence number.
+        for (uint32 i = 0; i < numSlots; ++i)
+        {
+            PAL_PLACEMENT_NEW(&m_pSlots[i].sequence) std::atomic<uint32>(i);
+        }
+
+        m_mask = numSlots - 1;
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Claims the slot at the tail position by advancing the tail, constructs the element in it and then publishes the slot
+// to consumers by bumping its sequence number.
+template<typename T, typename Allocator>
+template<typename U>
+bool MpmcRing<T, Allocator>::Emplace(
+    U&& data)
+{
+    bool   pushed = false;
+    uint32 pos    = m_tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot*const   pSlot    = &m_pSlots[pos & m_mask];
+        const uint32 sequence = pSlot->sequence.load(std::memory_order_acquire);
+        const int32  diff     = static_cast<int32>(sequence - pos);
+
+        if (diff == 0)
+        {
+            // The slot is free for this position; try to claim it.  On failure pos is reloaded with the new tail.
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                PAL_PLACEMENT_NEW(&pSlot->value) T(std::forward<U>(data));
+                pSlot->sequence.store(pos + 1, std::memory_order_release);
+
+                pushed = true;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the element from one lap ago: the ring is full.
+            break;
+        }
+        else
+        {
+            // Another producer claimed this position already.
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    return pushed;
+}
+
+// =====================================================================================================================
+// Claims the slot at the head position by advancing the head, moves the element out and then hands the slot back to
+// producers of the next lap by bumping its sequence number.
+template<typename T, typename Allocator>
+bool MpmcRing<T, Allocator>::TryPop(
+    T* pData)
+{
+    PAL_ASSERT(pData != nullptr);
+
+    bool   popped = false;
+    uint32 pos    = m_head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot*const   pSlot    = &m_pSlots[pos & m_mask];
+        const uint32 sequence = pSlot->sequence.load(std::memory_order_acquire);
+        const int32  diff     = static_cast<int32>(sequence - (pos + 1));
+
+        if (diff == 0)
+        {
+            if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                T*const pValue = reinterpret_cast<T*>(&pSlot->value);
+
+                *pData = Move(*pValue);
+                pValue->~T();
+                pSlot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+                popped = true;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Nothing has been published at this position yet: the ring is empty.
+            break;
+        }
+        else
+        {
+            // Another consumer claimed this position already.
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+
+    return popped;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+uint32 MpmcRing<T, Allocator>::NumElements() const
+{
+    const uint32 head = m_head.load(std::memory_order_acquire);
+    const uint32 tail = m_tail.load(std::memory_order_acquire);
+
+    // The positions are read separately, so clamp transient inconsistencies to the valid range.
+    return Min(static_cast<uint32>(Max(static_cast<int32>(tail - head), 0)), Capacity());
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+SpscRing<T, Allocator>::SpscRing(
+    Allocator*const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_pData(nullptr),
+    m_mask(0),
+    m_tail(0),
+    m_cachedHead(0),
+    m_head(0),
+    m_cachedTail(0)
+{
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+SpscRing<T, Allocator>::~SpscRing()
+{
+    if (m_pData != nullptr)
+    {
+        // Destroy every element which was pushed but never popped.
+        const uint32 tail = m_tail.load(std::memory_order_acquire);
+
+        for (uint32 pos = m_head.load(std::memory_order_acquire); pos != tail; ++pos)
+        {
+            m_pData[pos & m_mask].~T();
+        }
+
+        PAL_FREE(m_pData, m_pAllocator);
+    }
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+Result SpscRing<T, Allocator>::Init(
+    uint32 capacity)
+{
+    PAL_ASSERT((m_pData == nullptr) && (capacity <= (1u << 31)));
+
+    const uint32 numElements = Pow2Pad(Max(capacity, 2u));
+
+    Result result = Result::ErrorOutOfMemory;
+
+    m_pData = static_cast<T*>(PAL_MALLOC(sizeof(T) * numElements, m_pAllocator, AllocInternal));
+
+    if (m_pData != nullptr)
+    {
+        m_mask = numElements - 1;
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+template<typename U>
+bool SpscRing<T, Allocator>::Emplace(
+    U&& data)
+{
+    bool         pushed = false;
+    const uint32 tail   = m_tail.load(std::memory_order_relaxed);
+
+    // Only look at the consumer's position if the ring appears to be full.
+    if ((tail - m_cachedHead) > m_mask)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+    }
+
+    if ((tail - m_cachedHead) <= m_mask)
+    {
+        PAL_PLACEMENT_NEW(&m_pData[tail & m_mask]) T(std::forward<U>(data));
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        pushed = true;
+    }
+
+    return pushed;
+}
+
+// =====================================================================================================================
+template<typename T, typename Allocator>
+bool SpscRing<T, Allocator>::TryPop(
+    T* pData)
+{
+    PAL_ASSERT(pData != nullptr);
+
+    bool         popped = false;
+    const uint32 head   = m_head.load(std::memory_order_relaxed);
+
+    // Only look at the producer's position if the ring appears to be empty.
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+    }
+
+    if (head != m_cachedTail)
+    {
+        T*const pValue = &m_pData[head & m_mask];
+
+        *pData = Move(*pValue);
+        pValue->~T();
+        m_head.store(head + 1, std::memory_order_release);
+
+        popped = true;
+    }
+
+    return popped;
+}
+
+} // Util
@@ -72,6 +72,10 @@ void (TraverseCallback)(IntervalTreeNode<T, K>* pNode, void* pData);
  ***********************************************************************************************************************
  * @brief Red-black tree based interval tree.
  *
+ * Nodes are carved out of slabs obtained from the allocator and recycled through a free list, so inserting and deleting
+ * nodes normally doesn't allocate.  Clear() returns every node to the pool at once and keeps the slabs for reuse; they
+ * are only released when the tree is destroyed.
+ *
  * @note The Red-Black tree properties:
  *
  * 1. Every node is either red or black.
@@ -87,8 +91,18 @@ public:
     /// Constructor.
     ///
     /// @param [in] pAllocator The allocator that will allocate memory if required.
-    IntervalTree(Allocator*const pAllocator) : m_null(), m_pRoot(&m_null), m_count(0), m_pAllocator(pAllocator) { }
-    ~IntervalTree() { Destroy(m_pRoot); }
+    IntervalTree(Allocator*const pAllocator)
+        :
+        m_null(),
+        m_pRoot(&m_null),
+        m_count(0),
+        m_pAllocator(pAllocator),
+        m_pFirstSlab(nullptr),
+        m_pCurSlab(nullptr),
+        m_curSlabUsed(0),
+        m_pFreeNodes(nullptr)
+        { }
+    ~IntervalTree();
 
     /// Returns the number of nodes in the tree.
     size_t GetCount() const { return m_count; }
@@ -135,13 +149,8 @@ public:
         Delete(pNode);
     }
 
-    /// Clears the tree, removing all nodes.
-    void Clear()
-    {
-        Destroy(m_pRoot);
-        m_pRoot = GetNull();
-        m_count = 0;
-    }
+    /// Clears the tree, removing all nodes.  The memory backing the nodes is kept for reuse by later insertions.
+    void Clear();
 
     /// Returns a pointer to the tree node corresponding to the specified interval.
     IntervalTreeNode<T, K>* Search(const Interval<T, K>* pInterval) const;
@@ -186,14 +195,28 @@ public:
     Result InsertOrExtend(const Interval<T, K>* pInterval);
 
 private:
-    // Destroys tree rooted pRoot.
-    void Destroy(IntervalTreeNode<T, K>* pRoot)
+    // Header of a block of nodes allocated in one go; the nodes immediately follow it.
+    struct NodeSlab
+    {
+        NodeSlab* pNext;     // Next slab in allocation order.
+        uint32    capacity;  // Number of nodes in this slab.
+    };
+
+    static constexpr size_t NodeSlabHeaderSize = Pow2Align(sizeof(NodeSlab), alignof(IntervalTreeNode<T, K>));
+    static constexpr uint32 MinNodesPerSlab    = 16;
+    static constexpr uint32 MaxNodesPerSlab    = 1024;
+
+    IntervalTreeNode<T, K>* AllocNode();
+    void FreeNode(IntervalTreeNode<T, K>* pNode);
+
+    // Runs the destructor of every node in the tree rooted at pRoot.
+    void DestroyNodes(IntervalTreeNode<T, K>* pRoot)
     {
         if (pRoot != GetNull())
         {
-            Destroy(pRoot->pLeftChild);
-            Destroy(pRoot->pRightChild);
-            PAL_SAFE_DELETE(pRoot, m_pAllocator);
+            DestroyNodes(pRoot->pLeftChild);
+            DestroyNodes(pRoot->pRightChild);
+            pRoot->~IntervalTreeNode();
         }
     }
 
@@ -226,10 +249,14 @@ private:
     void SwapNodeTopology(IntervalTreeNode<T, K>* pA, IntervalTreeNode<T, K>* pB);
     void ResetNodeTopology(IntervalTreeNode<T, K>* pNode, IntervalTreeNode<T, K>* pRefNode);
 
-    IntervalTreeNode<T, K>        m_null;       // "Null" node/leaf.
-    IntervalTreeNode<T, K>*       m_pRoot;      // Tree root node.
-    size_t                        m_count;      // Node count in the tree.
-    Allocator*const               m_pAllocator; // Allocator for this interval tree.
+    IntervalTreeNode<T, K>        m_null;         // "Null" node/leaf.
+    IntervalTreeNode<T, K>*       m_pRoot;        // Tree root node.
+    size_t                        m_count;        // Node count in the tree.
+    Allocator*const               m_pAllocator;   // Allocator for this interval tree.
+    NodeSlab*                     m_pFirstSlab;   // First node slab.
+    NodeSlab*                     m_pCurSlab;     // Slab new nodes are currently carved from.
+    uint32                        m_curSlabUsed;  // Number of nodes carved from m_pCurSlab so far.
+    IntervalTreeNode<T, K>*       m_pFreeNodes;   // Deleted nodes available for reuse, linked through pParent.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(IntervalTree);
 };
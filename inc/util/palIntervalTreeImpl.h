@@ -36,6 +36,110 @@
 namespace Util
 {
 
+//======================================================================================================================
+template<typename T, typename K, typename Allocator>
+IntervalTree<T, K, Allocator>::~IntervalTree()
+{
+    DestroyNodes(m_pRoot);
+
+    while (m_pFirstSlab != nullptr)
+    {
+        NodeSlab* pNext = m_pFirstSlab->pNext;
+        PAL_FREE(m_pFirstSlab, m_pAllocator);
+        m_pFirstSlab = pNext;
+    }
+}
+
+//======================================================================================================================
+// Clears the tree.  Rather than returning the nodes one at a time, every slab is marked unused so that later insertions
+// carve nodes out of them from the start again.
+template<typename T, typename K, typename Allocator>
+void IntervalTree<T, K, Allocator>::Clear()
+{
+    if constexpr (std::is_trivially_destructible_v<IntervalTreeNode<T, K>> == false)
+    {
+        DestroyNodes(m_pRoot);
+    }
+
+    m_pRoot       = GetNull();
+    m_count       = 0;
+    m_pCurSlab    = m_pFirstSlab;
+    m_curSlabUsed = 0;
+    m_pFreeNodes  = nullptr;
+}
+
+//======================================================================================================================
+// Returns a default-constructed node taken from the free list, the current slab or a newly allocated slab.
+template<typename T, typename K, typename Allocator>
+IntervalTreeNode<T, K>* IntervalTree<T, K, Allocator>::AllocNode()
+{
+    void* pMem = nullptr;
+
+    if (m_pFreeNodes != nullptr)
+    {
+        pMem         = m_pFreeNodes;
+        m_pFreeNodes = m_pFreeNodes->pParent;
+    }
+    else
+    {
+        if ((m_pCurSlab != nullptr) && (m_curSlabUsed == m_pCurSlab->capacity) && (m_pCurSlab->pNext != nullptr))
+        {
+            // Move on to a slab which was retained by Clear().
+            m_pCurSlab    = m_pCurSlab->pNext;
+            m_curSlabUsed = 0;
+        }
+
+        if ((m_pCurSlab == nullptr) || (m_curSlabUsed == m_pCurSlab->capacity))
+        {
+            // Each new slab doubles the capacity of the previous one, up to a limit.
+            const uint32 capacity = (m_pCurSlab == nullptr) ? MinNodesPerSlab
+                                                            : Min(m_pCurSlab->capacity * 2, MaxNodesPerSlab);
+            NodeSlab*    pSlab    = static_cast<NodeSlab*>(
+                PAL_MALLOC(NodeSlabHeaderSize + (capacity * sizeof(IntervalTreeNode<T, K>)),
+                           m_pAllocator,
+                           AllocInternal));
+
+            if (pSlab != nullptr)
+            {
+                pSlab->pNext    = nullptr;
+                pSlab->capacity = capacity;
+
+                if (m_pCurSlab == nullptr)
+                {
+                    m_pFirstSlab = pSlab;
+                }
+                else
+                {
+                    m_pCurSlab->pNext = pSlab;
+                }
+
+                m_pCurSlab    = pSlab;
+                m_curSlabUsed = 0;
+            }
+        }
+
+        if ((m_pCurSlab != nullptr) && (m_curSlabUsed < m_pCurSlab->capacity))
+        {
+            pMem = VoidPtrInc(m_pCurSlab, NodeSlabHeaderSize + (m_curSlabUsed * sizeof(IntervalTreeNode<T, K>)));
+            m_curSlabUsed++;
+        }
+    }
+
+    return (pMem != nullptr) ? PAL_PLACEMENT_NEW(pMem) IntervalTreeNode<T, K>() : nullptr;
+}
+
+//======================================================================================================================
+// Destroys a node which is no longer part of the tree and puts it on the free list.
+template<typename T, typename K, typename Allocator>
+void IntervalTree<T, K, Allocator>::FreeNode(
+    IntervalTreeNode<T, K>* pNode)
+{
+    pNode->~IntervalTreeNode();
+
+    pNode->pParent = m_pFreeNodes;
+    m_pFreeNodes   = pNode;
+}
+
 //======================================================================================================================
 // Returns the tree node containing the specified interval - Null node is converted to nullptr.
 template<typename T, typename K, typename Allocator>
@@ -175,10 +279,7 @@ template<typename T, typename K, typename Allocator>
 IntervalTreeNode<T, K>* IntervalTree<T, K, Allocator>::Insert(
     const Interval<T, K>* pInterval)
 {
-    // The PAL_NEW macro doesn't work correctly with IntervalTreeNode because there is a comma in the template argument
-    // list.  Create a temporary typedef to get around this.
-    typedef IntervalTreeNode<T, K> TypeName;
-    IntervalTreeNode<T, K>* pNode = PAL_NEW(TypeName, m_pAllocator, AllocInternal);
+    IntervalTreeNode<T, K>* pNode = AllocNode();
 
     if (pNode != nullptr)
     {
@@ -261,7 +362,7 @@ void IntervalTree<T, K, Allocator>::Delete(
     if (pNode != GetNull())
     {
         Detach(pNode);
-        PAL_SAFE_DELETE(pNode, m_pAllocator);
+        FreeNode(pNode);
     }
 }
 
@@ -33,9 +33,12 @@
 
 #if PAL_MEMTRACK
 
+#include "palAllocShard.h"
 #include "palIntrusiveList.h"
 #include "palMutex.h"
 
+#include <atomic>
+
 namespace Util
 {
 
@@ -73,14 +76,29 @@ struct MemTrackerElem
     void*           pClientMem; ///< Starting "client usable" data address.
     void*           pOrigMem;   ///< Original address of the allocation returned from our underlying allocator.
     size_t          allocNum;   ///< The number of the memory allocation. 1 based.
+    SystemAllocType allocType;  ///< Allocation type the client specified.
     MemTrackerList* pList;      ///< The list this struct is in. It helps check which MemTracker owns this struct.
 };
 
+/// @internal
+///
+/// Allocation statistics the MemTracker keeps for each SystemAllocType.
+struct MemTrackerStats
+{
+    size_t liveCount;   ///< Number of allocations which have not been freed yet.
+    size_t liveBytes;   ///< Client-requested bytes of allocations which have not been freed yet.
+    size_t totalCount;  ///< Number of allocations made over the lifetime of the tracker.
+    size_t totalBytes;  ///< Client-requested bytes of all allocations made over the lifetime of the tracker.
+};
+
 /**
  ***********************************************************************************************************************
  * @brief Class responsible for tracking allocations and frees to notify the developer of memory leaks.
  *
  * Tracking is enabled/disabled via the PAL_MEMTRACK define.
+ *
+ * Allocations are tracked in a small number of shards, each with its own list and lock.  Every thread is assigned a
+ * shard the first time it allocates, so threads only contend when one frees memory another allocated.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -112,20 +130,46 @@ public:
     void Free(
         const FreeInfo& freeInfo);
 
+    /// Number of entries in the array filled by GetAllocStats().
+    static constexpr uint32 NumAllocStatsTypes = NumAllocTypeStats;
+
+    /// Returns allocation statistics for each SystemAllocType, merged across all shards.
+    ///
+    /// @param [out] pStats Indexed by (allocType - AllocObject); the last entry collects any unknown allocation type.
+    void GetAllocStats(
+        MemTrackerStats (*pStats)[NumAllocStatsTypes]) const;
+
+    /// Writes the merged allocation statistics to the debug output.  May be called at any time.
+    void LogAllocStats() const;
+
 private:
     void* AddMemElement(
-        void*       pMem,
-        size_t      bytes,
-        size_t      align,
-        MemBlkType  blockType,
-        const char* pFilename,
-        uint32      lineNumber);
+        void*           pMem,
+        size_t          bytes,
+        size_t          align,
+        MemBlkType      blockType,
+        const char*     pFilename,
+        uint32          lineNumber,
+        SystemAllocType allocType);
 
     void* RemoveMemElement(void* pMem, MemBlkType blockType);
 
     void MemoryReport();
     void FreeLeakedMemory();
 
+    // Number of independently locked allocation lists.
+    static constexpr uint32 NumShards = 8;
+
+    struct alignas(PAL_CACHE_LINE_BYTES) Shard
+    {
+        MemTrackerList  trackerList;               // The list of active allocations made by threads of this shard.
+        mutable Mutex   mutex;                     // Serializes access to trackerList and stats.
+        MemTrackerStats stats[NumAllocStatsTypes]; // Statistics of the allocations in this shard.
+    };
+
+    Shard* FindShard(const MemTrackerList* pList);
+    bool IsEmpty() const;
+
     // Sentinel patterns used to detect memory underrun.
     static constexpr uint32 UnderrunSentinel = 0xDEADBEEF;
     // Sentinel patterns used to detect memory overrun.
@@ -137,8 +181,7 @@ private:
     // Size of underrun/overrun markers in bytes.
     static constexpr size_t MarkerSizeBytes = MarkerSizeUints * sizeof(uint32);
 
-    MemTrackerList     m_trackerList;      // The list of active allocations.
-    Mutex              m_mutex;            // Serializes access to list of active allocations.
+    Shard              m_shards[NumShards]; // Allocation lists, selected by CurrentThreadShardIndex() on allocation.
 
     const size_t       m_markerSizeUints;  // Member variable copy of MarkerSizeUints.  Only used to prevent compiler
                                            //  warnings when MarkerSizeUints is 0.
@@ -147,7 +190,7 @@ private:
 
     Allocator*const    m_pAllocator;       // Allocator for performing the actual allocations.
 
-    size_t             m_nextAllocNum;     // The allocation number that the next allocated block will receive.
+    std::atomic<size_t> m_nextAllocNum;    // The allocation number that the next allocated block will receive.
     const size_t       m_breakOnAllocNum;  // The allocation number to trigger a debug break on.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(MemTracker);
@@ -61,6 +61,10 @@ MemTracker<Allocator>::MemTracker(
     m_nextAllocNum(1),
     m_breakOnAllocNum(0)
 {
+    for (uint32 shard = 0; shard < NumShards; ++shard)
+    {
+        memset(&m_shards[shard].stats[0], 0, sizeof(m_shards[shard].stats));
+    }
 }
 
 // =====================================================================================================================
@@ -68,7 +72,7 @@ template <typename Allocator>
 MemTracker<Allocator>::~MemTracker()
 {
     // Clean-up leaked memory if needed
-    if (m_trackerList.IsEmpty() == false)
+    if (IsEmpty() == false)
     {
         // If the list isn't empty, we have a leak.  The leak could either be caused by an internal PAL leak,
         // a client leak, or even the application not destroying API objects.
@@ -88,6 +92,40 @@ Result MemTracker<Allocator>::Init()
     return Result::Success;
 }
 
+// =====================================================================================================================
+// Returns the shard whose allocation list is pList, or null if pList doesn't belong to this tracker.
+template <typename Allocator>
+typename MemTracker<Allocator>::Shard* MemTracker<Allocator>::FindShard(
+    const MemTrackerList* pList)
+{
+    Shard* pShard = nullptr;
+
+    for (uint32 shard = 0; (shard < NumShards) && (pShard == nullptr); ++shard)
+    {
+        if (pList == &m_shards[shard].trackerList)
+        {
+            pShard = &m_shards[shard];
+        }
+    }
+
+    return pShard;
+}
+
+// =====================================================================================================================
+// Returns true if no tracked allocation is outstanding.  This is only meaningful if no other thread is allocating.
+template <typename Allocator>
+bool MemTracker<Allocator>::IsEmpty() const
+{
+    bool empty = true;
+
+    for (uint32 shard = 0; (shard < NumShards) && empty; ++shard)
+    {
+        empty = m_shards[shard].trackerList.IsEmpty();
+    }
+
+    return empty;
+}
+
 // =====================================================================================================================
 // Adds the newly allocated memory block to the list of blocks for tracking.
 //
@@ -97,12 +135,13 @@ Result MemTracker<Allocator>::Init()
 // See MemTracker::Alloc() which is used to allocate memory that is being tracked.
 template <typename Allocator>
 void* MemTracker<Allocator>::AddMemElement(
-    void*       pMem,        // [in,out] Original pointer allocated by MemTracker::Alloc.
-    size_t      bytes,       // Client requested allocation size in bytes.
-    size_t      align,       // The max of the client-requested alignment or the internal alignment, in bytes.
-    MemBlkType  blockType,   // Block type based on calling allocation routine.
-    const char* pFilename,   // Client filename that is requesting the memory.
-    uint32      lineNumber)  // Line number in client file that is requesting the memory.
+    void*           pMem,        // [in,out] Original pointer allocated by MemTracker::Alloc.
+    size_t          bytes,       // Client requested allocation size in bytes.
+    size_t          align,       // The max of the client-requested alignment or the internal alignment, in bytes.
+    MemBlkType      blockType,   // Block type based on calling allocation routine.
+    const char*     pFilename,   // Client filename that is requesting the memory.
+    uint32          lineNumber,  // Line number in client file that is requesting the memory.
+    SystemAllocType allocType)   // Allocation type specified by the client.
 {
     // Our internal data is all relative to the client pointer so find that first. See Alloc for more details.
     //   (align1)(MemTrackerList::Node)(MemTrackerElem)(underflow tracker)(client allocation)(align2)(overflow tracker)
@@ -129,20 +168,27 @@ void* MemTracker<Allocator>::AddMemElement(
     pNewElement->blockType  = blockType;
     pNewElement->pClientMem = pClientMem;
     pNewElement->pOrigMem   = pMem;
-    pNewElement->pList      = &m_trackerList;
-
-    MutexAuto lock(&m_mutex);
+    pNewElement->allocType  = allocType;
+    pNewElement->allocNum   = m_nextAllocNum.fetch_add(1, std::memory_order_relaxed);
 
     // Trigger an assert if we're about to allocate the break-on-allocation number.
-    if (m_nextAllocNum == m_breakOnAllocNum)
+    if (pNewElement->allocNum == m_breakOnAllocNum)
     {
         PAL_ASSERT_ALWAYS();
     }
 
-    pNewElement->allocNum = m_nextAllocNum;
-    ++m_nextAllocNum;
+    Shard*const pShard = &m_shards[CurrentThreadShardIndex(NumShards)];
+    pNewElement->pList = &pShard->trackerList;
+
+    MutexAuto lock(&pShard->mutex);
 
-    m_trackerList.PushFront(pNewNode);
+    MemTrackerStats*const pStats = &pShard->stats[AllocTypeStatsIndex(allocType)];
+    pStats->liveCount++;
+    pStats->liveBytes += bytes;
+    pStats->totalCount++;
+    pStats->totalBytes += bytes;
+
+    pShard->trackerList.PushFront(pNewNode);
 
     return pClientMem;
 }
@@ -170,9 +216,11 @@ void* MemTracker<Allocator>::RemoveMemElement(
     uint32*    pOverrun     = static_cast<uint32*>(VoidPtrInc(pClientMem, Pow2Align(pCurrent->size, sizeof(uint32))));
 
     // We should not be trying to free something twice or trying to free something which has not been allocated
-    // by this MemTracker. We can verify both of these things by checking that the tracker's pList is equal to the
-    // MemTracker's list.
-    if (pCurrent->pList != &m_trackerList)
+    // by this MemTracker. We can verify both of these things by checking that the tracker's pList is one of the
+    // MemTracker's lists.
+    Shard*const pShard = FindShard(pCurrent->pList);
+
+    if (pShard == nullptr)
     {
         // A free was attempted on an unrecognized pointer.
         PAL_DPERROR("Invalid Free Attempted with ptr = : (%#x)", pClientMem);
@@ -195,10 +243,15 @@ void* MemTracker<Allocator>::RemoveMemElement(
             PAL_ASSERT(*pOverrun++  == OverrunSentinel);
         }
 
-        // Remove our tracker from the list and set it's pList to null to detect a double-free in the future.
-        MutexAuto lock(&m_mutex);
+        // Remove our tracker from the list of the shard it was allocated in (which need not be the current thread's)
+        // and set it's pList to null to detect a double-free in the future.
+        MutexAuto lock(&pShard->mutex);
 
-        m_trackerList.Erase(pCurrentNode);
+        MemTrackerStats*const pStats = &pShard->stats[AllocTypeStatsIndex(pCurrent->allocType)];
+        pStats->liveCount--;
+        pStats->liveBytes -= pCurrent->size;
+
+        pShard->trackerList.Erase(pCurrentNode);
 
         pCurrent->pList = nullptr;
         pOrigPtr        = pCurrent->pOrigMem;
@@ -250,7 +303,8 @@ void* MemTracker<Allocator>::Alloc(
                              paddedAlignBytes,
                              allocInfo.blockType,
                              allocInfo.pFilename,
-                             allocInfo.lineNumber);
+                             allocInfo.lineNumber,
+                             allocInfo.allocType);
     }
 
     return pMem;
@@ -283,20 +337,24 @@ void MemTracker<Allocator>::Free(
 template <typename Allocator>
 void MemTracker<Allocator>::FreeLeakedMemory()
 {
-    for (MemTrackerList::Iter iter = m_trackerList.Begin(); iter.IsValid(); )
+    for (uint32 shard = 0; shard < NumShards; ++shard)
     {
-        MemTrackerElem*const pCurrent = iter.Get();
+        for (MemTrackerList::Iter iter = m_shards[shard].trackerList.Begin(); iter.IsValid(); )
+        {
+            MemTrackerElem*const pCurrent = iter.Get();
 
-        // Free will release the memory for tracking and the actual element. This will invalidate our list iterator
-        // unless we advance the iterator first.
-        iter.Next();
+            // Free will release the memory for tracking and the actual element. This will invalidate our list iterator
+            // unless we advance the iterator first.
+            iter.Next();
 
-        Free(FreeInfo(pCurrent->pClientMem, pCurrent->blockType));
+            Free(FreeInfo(pCurrent->pClientMem, pCurrent->blockType));
+        }
     }
 }
 
 // =====================================================================================================================
-// Outputs information about leaked memory by traversing the memory tracker list.
+// Outputs information about leaked memory by traversing the memory tracker lists.  The shards are merged so that the
+// blocks are listed from the most to the least recent allocation, as if there were only one list.
 template <typename Allocator>
 void MemTracker<Allocator>::MemoryReport()
 {
@@ -308,9 +366,36 @@ void MemTracker<Allocator>::MemoryReport()
     {
         PAL_DPWARN("================ List of Leaked Blocks ================");
 
-        for (MemTrackerList::Iter iter = m_trackerList.Begin(); iter.IsValid(); iter.Next())
+        // Each shard's list is (nearly) sorted by descending allocation number because new blocks are pushed to the
+        // front, so repeatedly taking the most recent head of all the shards yields a merged list.
+        MemTrackerList::Iter iters[NumShards] = {
+            m_shards[0].trackerList.Begin(), m_shards[1].trackerList.Begin(),
+            m_shards[2].trackerList.Begin(), m_shards[3].trackerList.Begin(),
+            m_shards[4].trackerList.Begin(), m_shards[5].trackerList.Begin(),
+            m_shards[6].trackerList.Begin(), m_shards[7].trackerList.Begin(),
+        };
+        static_assert(NumShards == 8, "Update the iterator initialization above.");
+
+        while (true)
         {
-            MemTrackerElem*const pCurrent = iter.Get();
+            MemTrackerList::Iter* pNext = nullptr;
+
+            for (uint32 shard = 0; shard < NumShards; ++shard)
+            {
+                if (iters[shard].IsValid() &&
+                    ((pNext == nullptr) || (iters[shard].Get()->allocNum > pNext->Get()->allocNum)))
+                {
+                    pNext = &iters[shard];
+                }
+            }
+
+            if (pNext == nullptr)
+            {
+                break;
+            }
+
+            MemTrackerElem*const pCurrent = pNext->Get();
+            pNext->Next();
 
             PAL_DPWARN(
                 "ClientMem = 0x%p, AllocSize = %8d, MemBlkType = %s, File = %-15s, LineNumber = %8d, AllocNum = %8d",
@@ -323,6 +408,64 @@ void MemTracker<Allocator>::MemoryReport()
         }
 
         PAL_DPWARN("================ End of List ===========================");
+
+        LogAllocStats();
+    }
+}
+
+// =====================================================================================================================
+// Sums the allocation statistics of all shards.  Each shard is locked in turn, so the result is a consistent snapshot
+// per shard but not necessarily across shards while other threads are allocating.
+template <typename Allocator>
+void MemTracker<Allocator>::GetAllocStats(
+    MemTrackerStats (*pStats)[NumAllocStatsTypes]
+    ) const
+{
+    memset(pStats, 0, sizeof(*pStats));
+
+    for (uint32 shard = 0; shard < NumShards; ++shard)
+    {
+        MutexAuto lock(&m_shards[shard].mutex);
+
+        for (uint32 type = 0; type < NumAllocStatsTypes; ++type)
+        {
+            const MemTrackerStats& shardStats = m_shards[shard].stats[type];
+
+            (*pStats)[type].liveCount  += shardStats.liveCount;
+            (*pStats)[type].liveBytes  += shardStats.liveBytes;
+            (*pStats)[type].totalCount += shardStats.totalCount;
+            (*pStats)[type].totalBytes += shardStats.totalBytes;
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes the merged allocation statistics to the debug output.
+template <typename Allocator>
+void MemTracker<Allocator>::LogAllocStats() const
+{
+    constexpr const char* AllocTypeStr[NumAllocStatsTypes] =
+    {
+        "AllocObject",
+        "AllocInternal",
+        "AllocInternalTemp",
+        "AllocInternalShader",
+        "Unknown",
+    };
+
+    MemTrackerStats stats[NumAllocStatsTypes];
+    GetAllocStats(&stats);
+
+    PAL_DPINFO("================ Allocation Statistics =================");
+
+    for (uint32 type = 0; type < NumAllocStatsTypes; ++type)
+    {
+        PAL_DPINFO("%-19s: Live = %8zu (%12zu bytes), Total = %10zu (%14zu bytes)",
+                   AllocTypeStr[type],
+                   stats[type].liveCount,
+                   stats[type].liveBytes,
+                   stats[type].totalCount,
+                   stats[type].totalBytes);
     }
 }
 
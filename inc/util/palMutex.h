@@ -33,6 +33,7 @@
 
 #include "palAssert.h"
 
+#include <atomic>
 #include <pthread.h>
 #include <string.h>
 
@@ -49,11 +50,11 @@ class Mutex
 public:
     /// Defines MutexData as a unix pthread_mutex_t
     typedef pthread_mutex_t MutexData;
-    Mutex() noexcept : m_osMutex {} { pthread_mutex_init(&m_osMutex, nullptr); }
+    Mutex() noexcept : m_osMutex {}, m_spinEstimate(0) { pthread_mutex_init(&m_osMutex, nullptr); }
     ~Mutex() { pthread_mutex_destroy(&m_osMutex); };
 
-    /// Enters the critical section if it is not contended.  If it is contended, wait for the critical section to become
-    /// available, then enter it.
+    /// Enters the critical section if it is not contended.  If it is contended, spin briefly in case the owner is about
+    /// to leave it, then wait for the critical section to become available and enter it.
     void Lock();
 
     /// Enters the critical section if it is not contended.  Does not wait for the critical section to become available
@@ -69,7 +70,8 @@ public:
     MutexData* GetMutexData() { return &m_osMutex; }
 
 private:
-    MutexData m_osMutex;     ///< Opaque structure to the OS-specific Mutex data
+    MutexData           m_osMutex;       ///< Opaque structure to the OS-specific Mutex data
+    std::atomic<uint32> m_spinEstimate;  ///< Running average of the spins Lock() needed to acquire a contended mutex.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(Mutex);
 };
@@ -120,16 +122,32 @@ private:
 /**
  ***********************************************************************************************************************
  * @brief Platform-agnostic rw lock primitive.
+ *
+ * Implemented directly on a futex: uncontended lock and unlock are a single atomic operation, contended acquires spin
+ * for a bounded time before sleeping, and unlocks only enter the kernel when somebody is asleep.
  ***********************************************************************************************************************
  */
 class RWLock
 {
 public:
-    /// Defines RWLockData as a unix pthread_rwlock_t
-    typedef pthread_rwlock_t  RWLockData;
-    /// @note pthread_rwlock_init will not fail as called
-    RWLock() noexcept : m_osRWLock {} { pthread_rwlock_init(&m_osRWLock, nullptr); }
-    ~RWLock() noexcept { pthread_rwlock_destroy(&m_osRWLock); };
+    /// Defines RWLockData as the futex word holding the lock state
+    typedef std::atomic<uint32> RWLockData;
+
+    /// Selects which side is favored while a writer is waiting.
+    enum class Policy : uint32
+    {
+        PreferReader = 0,  ///< New readers may still enter while a writer waits for existing readers to leave.  This
+                           ///  maximizes read throughput but a steady stream of readers can starve writers.
+        PreferWriter,      ///< New readers wait behind a waiting writer.
+    };
+
+    explicit RWLock(Policy policy = Policy::PreferReader) noexcept
+        :
+        m_state(0),
+        m_writerNotify(0),
+        m_policy(policy)
+    { }
+    ~RWLock() noexcept { };
 
     /// Enumerates the lock type of RWLockAuto
     enum LockType
@@ -163,14 +181,87 @@ public:
     void UnlockForWrite();
 
     /// Returns the OS specific RWLOCK data.
-    RWLockData* GetRWLockData() { return &m_osRWLock; }
+    RWLockData* GetRWLockData() { return &m_state; }
 
 private:
-    RWLockData m_osRWLock;    ///< Opaque structure to the OS-specific RWLock data
+    // Layout of m_state: the low bits count the readers holding the lock, or are all set while a writer holds it, and
+    // the top two bits record whether readers or writers are asleep waiting for it.
+    static constexpr uint32 LockedMask     = (1u << 30) - 1;
+    static constexpr uint32 WriteLocked    = LockedMask;
+    static constexpr uint32 MaxReaders     = LockedMask - 1;
+    static constexpr uint32 ReadersWaiting = 1u << 30;
+    static constexpr uint32 WritersWaiting = 1u << 31;
+
+    bool   IsReadLockable(uint32 state) const;
+    uint32 SpinRead() const;
+    uint32 SpinWrite() const;
+    void   LockForReadContended();
+    void   LockForWriteContended();
+    void   WakeWriterOrReaders(uint32 state);
+    bool   WakeWriter();
+
+    RWLockData          m_state;         ///< Reader count or write-locked value, plus the waiting flags.
+    std::atomic<uint32> m_writerNotify;  ///< Futex word writers sleep on; bumped each time a writer is woken.
+    const Policy        m_policy;        ///< Whether readers yield to waiting writers.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(RWLock);
 };
 
+/**
+ ***********************************************************************************************************************
+ * @brief Reader-biased rw lock for data which is read far more often than it is written.
+ *
+ * Readers only touch a reader counter on their own cache line (threads are spread over a fixed set of counters), so
+ * readers running on different cores never contend with each other.  The price is paid by writers, which must announce
+ * themselves and then wait until every counter drains, so this should only replace an RWLock where writes are rare.
+ * The interface matches RWLock, and it may be used with RWLockAuto.  A lock must be released by the thread which
+ * acquired it.
+ ***********************************************************************************************************************
+ */
+class ReaderBiasedRWLock
+{
+public:
+    ReaderBiasedRWLock() noexcept : m_readers {}, m_writerActive(false), m_writerLock() { }
+    ~ReaderBiasedRWLock() noexcept { }
+
+    /// Acquires the lock in shared mode, waiting while a writer holds it.
+    void LockForRead();
+
+    /// Acquires the lock in exclusive mode, waiting for all readers and any other writer to leave.
+    void LockForWrite();
+
+    /// Tries to acquire the lock in shared mode without waiting.
+    /// @returns True if the lock was acquired, false otherwise.
+    bool TryLockForRead();
+
+    /// Tries to acquire the lock in exclusive mode without waiting.
+    /// @returns True if the lock was acquired, false otherwise.
+    bool TryLockForWrite();
+
+    /// Releases the lock previously acquired in shared mode by this thread.
+    void UnlockForRead();
+
+    /// Releases the lock previously acquired in exclusive mode.
+    void UnlockForWrite();
+
+private:
+    static constexpr uint32 NumReaderSlots = 16;
+
+    struct alignas(PAL_CACHE_LINE_BYTES) ReaderSlot
+    {
+        std::atomic<uint32> count;  ///< Readers which entered through this slot and have not left yet.
+    };
+
+    static uint32 ReaderSlotIndex();
+    bool          HasReaders() const;
+
+    ReaderSlot        m_readers[NumReaderSlots];  ///< Per-thread-group reader counters.
+    std::atomic<bool> m_writerActive;             ///< Set while a writer holds or is acquiring the lock.
+    RWLock            m_writerLock;               ///< Serializes writers; readers fall back to it while one is active.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(ReaderBiasedRWLock);
+};
+
 /**
  ***********************************************************************************************************************
  * @brief A "resource acquisition is initialization" (RAII) wrapper for the RWLock class.
@@ -189,14 +280,16 @@ private:
  *         [Code is protected]
  *     }
  *     [Code not protected]
+ *
+ * LockClass may be any class with the RWLock locking interface, such as ReaderBiasedRWLock.
  ***********************************************************************************************************************
  */
-template <RWLock::LockType type>
+template <RWLock::LockType type, typename LockClass = RWLock>
 class RWLockAuto
 {
 public:
     /// Locks the given RWLock.
-    explicit RWLockAuto(RWLock* pRWLock) : m_pRWLock(pRWLock)
+    explicit RWLockAuto(LockClass* pRWLock) : m_pRWLock(pRWLock)
     {
         PAL_ASSERT(m_pRWLock != nullptr);
         if (type == RWLock::ReadOnly)
@@ -223,7 +316,7 @@ public:
     }
 
 private:
-    RWLock* const m_pRWLock;  ///< The RWLock which this object wraps.
+    LockClass* const m_pRWLock;  ///< The RWLock which this object wraps.
 
     PAL_DISALLOW_DEFAULT_CTOR(RWLockAuto);
     PAL_DISALLOW_COPY_AND_ASSIGN(RWLockAuto);
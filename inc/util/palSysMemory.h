@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include "palAllocShard.h"
 #include "palAssert.h"
 #include "palInlineFuncs.h"
 #include "palMemTracker.h"
@@ -250,6 +251,16 @@ enum SystemAllocType : uint32
     AllocInternalShader = 0x80000003
 };
 
+/// Maps an allocation type to its index in statistics arrays.  Declared in palAllocShard.h and defined here, after the
+/// SystemAllocType values.
+inline uint32 AllocTypeStatsIndex(
+    SystemAllocType allocType)
+{
+    const uint32 index = static_cast<uint32>(allocType) - static_cast<uint32>(AllocObject);
+
+    return Min(index, NumAllocTypeStats - 1);
+}
+
 /// Function pointer type defining a callback for client-controlled system memory allocation.
 ///
 /// @see AllocCallbacks
@@ -0,0 +1,237 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palTaskPool.h
+ * @brief PAL utility collection TaskPool class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConcurrentRing.h"
+#include "palConditionVariable.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+
+#include <atomic>
+
+namespace Util
+{
+
+/// Function executed by a @ref Task.
+typedef void (*TaskFunction)(void* pArg);
+
+/// Function executed by each chunk of a @ref TaskPool::ParallelFor() call, over the index range [begin, end).
+typedef void (*ParallelForFunction)(void* pArg, uint32 begin, uint32 end);
+
+/// Callback used to launch a worker on a client-owned thread instead of a thread created by the pool.  The client must
+/// arrange for pfnWorkerMain(pWorkerArg) to be called on its thread; the call returns once the pool is destroyed.
+///
+/// @returns Success if the worker was launched, or an error code which fails @ref TaskPool::Init().
+typedef Result (*LaunchWorkerFunc)(void* pClientData, Thread::StartFunction pfnWorkerMain, void* pWorkerArg);
+
+/**
+ ***********************************************************************************************************************
+ * @brief Counts the outstanding tasks of a fork/join region.
+ *
+ * Every task submitted with a group increments it and decrements it once its function returns.  The group must outlive
+ * all of its tasks; @ref TaskPool::Wait() is the usual way to ensure that.
+ ***********************************************************************************************************************
+ */
+class TaskGroup
+{
+public:
+    TaskGroup() : m_numPending(0) { }
+    ~TaskGroup() { PAL_ASSERT(IsDone()); }
+
+    /// Returns true if every task submitted with this group has finished.
+    bool IsDone() const { return (m_numPending.load(std::memory_order_acquire) == 0); }
+
+private:
+    template<typename Allocator> friend class TaskPool;
+
+    std::atomic<uint32> m_numPending;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(TaskGroup);
+};
+
+/// A unit of work for a @ref TaskPool.  The memory is owned by the submitter and must stay valid until the task has
+/// started running; the pool never copies or frees it.
+struct Task
+{
+    TaskFunction pfnExecute;  ///< Function to run.
+    void*        pArg;        ///< Argument passed to pfnExecute.
+    TaskGroup*   pGroup;      ///< Group tracking this task.  May be null for fire-and-forget tasks.
+};
+
+/// Specifies properties for @ref TaskPool creation.
+struct TaskPoolCreateInfo
+{
+    uint32           numWorkers;       ///< Number of worker threads.  Zero picks one less than the logical core count,
+                                       ///  since the thread calling Wait() also runs tasks.
+    uint32           dequeCapacity;    ///< Tasks each worker can have queued before Submit() runs tasks inline.
+                                       ///  Rounded up to a power of two; zero selects a default.
+    uint32           injectCapacity;   ///< Tasks non-worker threads can have queued before Submit() runs tasks inline.
+                                       ///  Rounded up to a power of two; zero selects a default.
+    LaunchWorkerFunc pfnLaunchWorker;  ///< Optional.  If set, workers run on client threads launched by this callback.
+    void*            pClientData;      ///< Passed to pfnLaunchWorker.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Work-stealing task scheduler.
+ *
+ * Each worker owns a Chase-Lev deque: it pushes and pops its own tasks at the bottom (LIFO, so nested forks stay hot in
+ * its caches) while idle workers steal from the top (FIFO, so they take the oldest and usually largest work).  Threads
+ * which are not workers of the pool submit into a shared lock-free injection queue.  Idle workers sleep on a semaphore
+ * which Submit() only signals when somebody is asleep, so a busy pool never enters the kernel.
+ *
+ * Wait() does not block while its group has queued work: the waiting thread runs tasks itself, which keeps nested
+ * fork/join from deadlocking and lets the submitting thread contribute to the work.  Once there is nothing left to help
+ * with, it yields for a short while and then sleeps until a group finishes or Submit() finds no idle worker.
+ ***********************************************************************************************************************
+ */
+template<typename Allocator>
+class TaskPool
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    TaskPool(Allocator*const pAllocator);
+
+    /// Stops and joins all workers.  Tasks still queued at this point are not run.
+    ~TaskPool();
+
+    /// Allocates the queues and launches the workers.
+    ///
+    /// @param [in] createInfo Pool properties.
+    ///
+    /// @returns Success if the pool is ready for use, ErrorOutOfMemory if allocation failed, or the error from
+    ///          launching a worker thread.
+    Result Init(const TaskPoolCreateInfo& createInfo);
+
+    /// Queues a task (fork).  If the calling thread's queue is full the task is run immediately instead.
+    ///
+    /// @param [in] pTask Task to run.  If pTask->pGroup is not null, the group is incremented before this returns.
+    void Submit(Task* pTask);
+
+    /// Runs queued tasks until every task of the group has finished (join).
+    ///
+    /// @param [in] pGroup Group to wait on.
+    void Wait(TaskGroup* pGroup);
+
+    /// Splits [0, count) into chunks of at least grainSize indices, runs them across the pool and returns when all of
+    /// them have finished.  Small ranges are run inline on the calling thread.
+    ///
+    /// @param [in] count     Number of indices.
+    /// @param [in] grainSize Minimum number of indices per chunk; zero is treated as one.
+    /// @param [in] pfnBody   Function called for each chunk.
+    /// @param [in] pArg      Argument passed to pfnBody.
+    void ParallelFor(uint32 count, uint32 grainSize, ParallelForFunction pfnBody, void* pArg);
+
+    /// Returns the number of workers, not counting threads which help from Wait().
+    uint32 NumWorkers() const { return m_numWorkers; }
+
+private:
+    // Maximum number of chunks a ParallelFor() call is split into.  The chunk tasks live on the caller's stack.
+    static constexpr uint32 MaxParallelForChunks = 64;
+
+    // Number of consecutive failed task searches after which Wait() stops yielding and goes to sleep.
+    static constexpr uint32 WaitSpinCount = 64;
+
+    // Fixed-capacity Chase-Lev work-stealing deque of task pointers, using the C11 memory orders of Le et al.,
+    // "Correct and Efficient Work-Stealing for Weak Memory Models".  Only the owning worker may call Push() and Take().
+    class WorkDeque
+    {
+    public:
+        WorkDeque() : m_pSlots(nullptr), m_mask(0), m_top(0), m_bottom(0) { }
+
+        Result Init(Allocator* pAllocator, uint32 capacity);
+        void   Destroy(Allocator* pAllocator);
+
+        bool  Push(Task* pTask);
+        Task* Take();
+        Task* Steal();
+
+    private:
+        std::atomic<Task*>* m_pSlots;
+        int64               m_mask;
+
+        // Thieves contend on the top while the owner mostly touches the bottom, so keep them on separate cache lines.
+        alignas(PAL_CACHE_LINE_BYTES) std::atomic<int64> m_top;
+        alignas(PAL_CACHE_LINE_BYTES) std::atomic<int64> m_bottom;
+    };
+
+    struct Worker
+    {
+        TaskPool* pPool;
+        uint32    index;
+        uint32    nextVictim;  // Worker to try stealing from first; rotates to spread thieves across victims.
+        WorkDeque deque;
+        Thread    thread;      // Unused if the worker runs on a client thread.
+    };
+
+    struct ParallelForChunk
+    {
+        Task                task;
+        ParallelForFunction pfnBody;
+        void*               pArg;
+        uint32              begin;
+        uint32              end;
+    };
+
+    static void WorkerMain(void* pArg);
+    static void RunParallelForChunk(void* pArg);
+
+    Worker* CurrentWorker() const;
+    Task*   FindTask(Worker* pWorker);
+    Task*   StealTask(uint32 firstVictim);
+    void    RunTask(Task* pTask);
+    void    WakeWorker();
+    void    Shutdown();
+
+    Allocator*const            m_pAllocator;
+    Worker*                    m_pWorkers;
+    uint32                     m_numWorkers;
+    MpmcRing<Task*, Allocator> m_injectQueue;    // Tasks submitted by threads which are not workers of this pool.
+    Semaphore                  m_wakeSemaphore;  // Signaled to wake sleeping workers.
+    std::atomic<uint32>        m_numSleepers;    // Workers which are (about to be) waiting on m_wakeSemaphore.
+    Mutex                      m_waitLock;       // Protects sleeping in Wait() against a racing group completion.
+    ConditionVariable          m_waitCondition;  // Signaled when a group finishes or work needs help.
+    std::atomic<uint32>        m_numWaiters;     // Threads which are (about to be) sleeping in Wait().
+    std::atomic<uint32>        m_numRunning;     // Workers which have not yet returned from WorkerMain().
+    std::atomic<bool>          m_shutdown;       // Set when the workers should exit.
+
+    // Worker which the calling thread is running as, if any.  Workers of other pools are ignored by checking pPool.
+    static thread_local Worker* s_pCurrentWorker;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(TaskPool);
+    PAL_DISALLOW_DEFAULT_CTOR(TaskPool);
+};
+
+} // Util
@@ -0,0 +1,595 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palTaskPoolImpl.h
+ * @brief PAL utility collection TaskPool class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConcurrentRingImpl.h"
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palSysUtil.h"
+#include "palTaskPool.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Allocator>
+thread_local typename TaskPool<Allocator>::Worker* TaskPool<Allocator>::s_pCurrentWorker = nullptr;
+
+// =====================================================================================================================
+template<typename Allocator>
+Result TaskPool<Allocator>::WorkDeque::Init(
+    Allocator* pAllocator,
+    uint32     capacity)
+{
+    PAL_ASSERT((m_pSlots == nullptr) && (capacity <= (1u << 31)));
+
+    const uint32 numSlots = Pow2Pad(Max(capacity, 2u));
+
+    Result result = Result::ErrorOutOfMemory;
+
+    m_pSlots = static_cast<std::atomic<Task*>*>(
+        PAL_MALLOC(sizeof(std::atomic<Task*>) * numSlots, pAllocator, AllocInternal));
+
+    if (m_pSlots != nullptr)
+    {
+        for (uint32 i = 0; i < numSlots; ++i)
+        {
+            PAL_PLACEMENT_NEW(&m_pSlots[i]) std::atomic<Task*>(nullptr);
+        }
+
+        m_mask = numSlots - 1;
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::WorkDeque::Destroy(
+    Allocator* pAllocator)
+{
+    PAL_SAFE_FREE(m_pSlots, pAllocator);
+}
+
+// =====================================================================================================================
+// Pushes a task onto the bottom of the deque.  Returns false if the deque is full.
+template<typename Allocator>
+bool TaskPool<Allocator>::WorkDeque::Push(
+    Task* pTask)
+{
+    const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+    const int64 top    = m_top.load(std::memory_order_acquire);
+
+    bool pushed = false;
+
+    // The top we read may be stale, but only in the direction of making the deque look fuller than it is.
+    if ((bottom - top) <= m_mask)
+    {
+        m_pSlots[bottom & m_mask].store(pTask, std::memory_order_relaxed);
+
+        // Release so that a thief which sees the new bottom also sees the task and everything it points to.
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        pushed = true;
+    }
+
+    return pushed;
+}
+
+// =====================================================================================================================
+// Pops the most recently pushed task from the bottom of the deque, or returns null if it is empty.
+template<typename Allocator>
+Task* TaskPool<Allocator>::WorkDeque::Take()
+{
+    // Reserve the bottom slot before looking at the top.  The fence orders the two so that a concurrent thief either
+    // sees the reservation or we see its increment of the top.
+    const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64 top = m_top.load(std::memory_order_relaxed);
+
+    Task* pTask = nullptr;
+
+    if (top <= bottom)
+    {
+        pTask = m_pSlots[bottom & m_mask].load(std::memory_order_relaxed);
+
+        if (top == bottom)
+        {
+            // This is the last task, so we have to race any thieves for it through the top.
+            if (m_top.compare_exchange_strong(top,
+                                              top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed) == false)
+            {
+                pTask = nullptr;
+            }
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        // The deque was already empty; undo the reservation.
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    return pTask;
+}
+
+// =====================================================================================================================
+// Removes the oldest task from the top of the deque.  Returns null if the deque is empty or if another thread won the
+// race for the task; either way the caller should move on to another victim.
+template<typename Allocator>
+Task* TaskPool<Allocator>::WorkDeque::Steal()
+{
+    int64 top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+    Task* pTask = nullptr;
+
+    if (top < bottom)
+    {
+        pTask = m_pSlots[top & m_mask].load(std::memory_order_relaxed);
+
+        if (m_top.compare_exchange_strong(top,
+                                          top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed) == false)
+        {
+            pTask = nullptr;
+        }
+    }
+
+    return pTask;
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+TaskPool<Allocator>::TaskPool(
+    Allocator*const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_pWorkers(nullptr),
+    m_numWorkers(0),
+    m_injectQueue(pAllocator),
+    m_numSleepers(0),
+    m_numWaiters(0),
+    m_numRunning(0),
+    m_shutdown(false)
+{
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+TaskPool<Allocator>::~TaskPool()
+{
+    Shutdown();
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+Result TaskPool<Allocator>::Init(
+    const TaskPoolCreateInfo& createInfo)
+{
+    PAL_ASSERT(m_pWorkers == nullptr);
+
+    uint32 numWorkers = createInfo.numWorkers;
+
+    if (numWorkers == 0)
+    {
+        SystemInfo systemInfo = {};
+
+        if ((QuerySystemInfo(&systemInfo) == Result::Success) && (systemInfo.cpuLogicalCoreCount > 1))
+        {
+            numWorkers = systemInfo.cpuLogicalCoreCount - 1;
+        }
+    }
+
+    const uint32 dequeCapacity  = (createInfo.dequeCapacity  != 0) ? createInfo.dequeCapacity  : 256;
+    const uint32 injectCapacity = (createInfo.injectCapacity != 0) ? createInfo.injectCapacity : 1024;
+
+    Result result = m_wakeSemaphore.Init(Semaphore::MaximumCountLimit, 0);
+
+    if (result == Result::Success)
+    {
+        result = m_injectQueue.Init(injectCapacity);
+    }
+
+    if ((result == Result::Success) && (numWorkers > 0))
+    {
+        m_pWorkers = PAL_NEW_ARRAY(Worker, numWorkers, m_pAllocator, AllocInternal);
+
+        if (m_pWorkers == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+
+        for (uint32 i = 0; (result == Result::Success) && (i < numWorkers); ++i)
+        {
+            m_pWorkers[i].pPool      = this;
+            m_pWorkers[i].index      = i;
+            m_pWorkers[i].nextVictim = i + 1;
+
+            result = m_pWorkers[i].deque.Init(m_pAllocator, dequeCapacity);
+        }
+    }
+
+    if (m_pWorkers != nullptr)
+    {
+        // Every worker must be visible to thieves before the first one starts.
+        m_numWorkers = numWorkers;
+
+        for (uint32 i = 0; (result == Result::Success) && (i < numWorkers); ++i)
+        {
+            Worker*const pWorker = &m_pWorkers[i];
+
+            m_numRunning.fetch_add(1, std::memory_order_relaxed);
+
+            if (createInfo.pfnLaunchWorker != nullptr)
+            {
+                result = createInfo.pfnLaunchWorker(createInfo.pClientData, &WorkerMain, pWorker);
+            }
+            else
+            {
+                result = pWorker->thread.Begin(&WorkerMain, pWorker);
+            }
+
+            if (result != Result::Success)
+            {
+                m_numRunning.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (result != Result::Success)
+    {
+        Shutdown();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Stops the workers and frees their state.  Safe to call on a partially initialized pool.
+template<typename Allocator>
+void TaskPool<Allocator>::Shutdown()
+{
+    if (m_pWorkers != nullptr)
+    {
+        m_shutdown.store(true, std::memory_order_release);
+        m_wakeSemaphore.Post(m_numWorkers);
+
+        // Client-launched workers cannot be joined, so wait for every worker to leave WorkerMain() before freeing the
+        // state they use.
+        while (m_numRunning.load(std::memory_order_acquire) != 0)
+        {
+            YieldThread();
+        }
+
+        for (uint32 i = 0; i < m_numWorkers; ++i)
+        {
+            if (m_pWorkers[i].thread.IsCreated())
+            {
+                m_pWorkers[i].thread.Join();
+            }
+
+            m_pWorkers[i].deque.Destroy(m_pAllocator);
+        }
+
+        PAL_SAFE_DELETE_ARRAY(m_pWorkers, m_pAllocator);
+        m_numWorkers = 0;
+    }
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::Submit(
+    Task* pTask)
+{
+    PAL_ASSERT((pTask != nullptr) && (pTask->pfnExecute != nullptr));
+
+    if (pTask->pGroup != nullptr)
+    {
+        pTask->pGroup->m_numPending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Worker*const pWorker = CurrentWorker();
+
+    const bool queued = (pWorker != nullptr) ? pWorker->deque.Push(pTask) : m_injectQueue.TryPush(pTask);
+
+    if (queued)
+    {
+        WakeWorker();
+    }
+    else
+    {
+        // Running the task here is always correct and is the natural back-pressure when producers outrun the pool.
+        RunTask(pTask);
+    }
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::Wait(
+    TaskGroup* pGroup)
+{
+    PAL_ASSERT(pGroup != nullptr);
+
+    Worker*const pWorker = CurrentWorker();
+
+    uint32 numFailedSearches = 0;
+
+    // Help with whatever work is queued rather than blocking; the tasks we are waiting on may be behind it, or may be
+    // in our own deque if we are a worker.
+    while (pGroup->IsDone() == false)
+    {
+        Task* pTask = FindTask(pWorker);
+
+        if (pTask != nullptr)
+        {
+            numFailedSearches = 0;
+        }
+        else if (++numFailedSearches < WaitSpinCount)
+        {
+            YieldThread();
+        }
+        else
+        {
+            // The rest of the group is running on other threads, so sleep until RunTask() tells us that a group has
+            // finished or WakeWorker() has work which no idle worker can take.
+            MutexAuto lock(&m_waitLock);
+
+            m_numWaiters.fetch_add(1, std::memory_order_seq_cst);
+
+            // Check one last time; either RunTask() sees us as a waiter or we see that the group is done.
+            pTask = FindTask(pWorker);
+
+            if ((pTask == nullptr) && (pGroup->m_numPending.load(std::memory_order_seq_cst) != 0))
+            {
+                m_waitCondition.Wait(&m_waitLock, std::chrono::milliseconds::max());
+            }
+
+            m_numWaiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (pTask != nullptr)
+        {
+            RunTask(pTask);
+        }
+    }
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::ParallelFor(
+    uint32              count,
+    uint32              grainSize,
+    ParallelForFunction pfnBody,
+    void*               pArg)
+{
+    PAL_ASSERT(pfnBody != nullptr);
+
+    const uint32 grain     = Max(grainSize, 1u);
+    uint32       numChunks = Min((count / grain) + (((count % grain) != 0) ? 1u : 0u), MaxParallelForChunks);
+
+    if (numChunks <= 1)
+    {
+        if (count > 0)
+        {
+            pfnBody(pArg, 0, count);
+        }
+    }
+    else
+    {
+        const uint32 chunkSize = (count / numChunks) + (((count % numChunks) != 0) ? 1u : 0u);
+        numChunks              = (count / chunkSize) + (((count % chunkSize) != 0) ? 1u : 0u);
+
+        ParallelForChunk chunks[MaxParallelForChunks];
+        TaskGroup        group;
+
+        for (uint32 i = 0; i < numChunks; ++i)
+        {
+            chunks[i].task.pfnExecute = &RunParallelForChunk;
+            chunks[i].task.pArg       = &chunks[i];
+            chunks[i].task.pGroup     = &group;
+            chunks[i].pfnBody         = pfnBody;
+            chunks[i].pArg            = pArg;
+            chunks[i].begin           = i * chunkSize;
+            chunks[i].end             = Min(count, chunks[i].begin + chunkSize);
+        }
+
+        // Queue the later chunks in reverse so that thieves, which take from the top, start with the far end of the
+        // range while this thread works forward from the beginning.
+        for (uint32 i = numChunks - 1; i > 0; --i)
+        {
+            Submit(&chunks[i].task);
+        }
+
+        RunParallelForChunk(&chunks[0]);
+        Wait(&group);
+    }
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::RunParallelForChunk(
+    void* pArg)
+{
+    const ParallelForChunk*const pChunk = static_cast<const ParallelForChunk*>(pArg);
+
+    pChunk->pfnBody(pChunk->pArg, pChunk->begin, pChunk->end);
+}
+
+// =====================================================================================================================
+// Entry point of every worker, whether on a pool-owned or client-owned thread.
+template<typename Allocator>
+void TaskPool<Allocator>::WorkerMain(
+    void* pArg)
+{
+    // Sleepers also poll at this interval in case a wake-up was lost to a racing Submit().
+    constexpr std::chrono::milliseconds IdleTimeout{ 10 };
+
+    Worker*const   pWorker = static_cast<Worker*>(pArg);
+    TaskPool*const  pPool   = pWorker->pPool;
+
+    s_pCurrentWorker = pWorker;
+
+    while (pPool->m_shutdown.load(std::memory_order_acquire) == false)
+    {
+        Task* pTask = pPool->FindTask(pWorker);
+
+        if (pTask == nullptr)
+        {
+            // Announce that we are going to sleep before checking one last time, so that a Submit() which raced with
+            // the failed search above either sees us as a sleeper or its task is found here.
+            pPool->m_numSleepers.fetch_add(1, std::memory_order_seq_cst);
+
+            pTask = pPool->FindTask(pWorker);
+
+            if ((pTask == nullptr) && (pPool->m_shutdown.load(std::memory_order_acquire) == false))
+            {
+                pPool->m_wakeSemaphore.Wait(IdleTimeout);
+            }
+
+            pPool->m_numSleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (pTask != nullptr)
+        {
+            pPool->RunTask(pTask);
+        }
+    }
+
+    s_pCurrentWorker = nullptr;
+
+    // This must be the last access to the pool: once the count reaches zero, Shutdown() may free it.
+    pPool->m_numRunning.fetch_sub(1, std::memory_order_release);
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+typename TaskPool<Allocator>::Worker* TaskPool<Allocator>::CurrentWorker() const
+{
+    Worker*const pWorker = s_pCurrentWorker;
+
+    return ((pWorker != nullptr) && (pWorker->pPool == this)) ? pWorker : nullptr;
+}
+
+// =====================================================================================================================
+// Looks for a task in the order that best preserves locality: our own deque, then the injection queue, then the other
+// workers' deques.
+template<typename Allocator>
+Task* TaskPool<Allocator>::FindTask(
+    Worker* pWorker)
+{
+    Task* pTask = nullptr;
+
+    if (pWorker != nullptr)
+    {
+        pTask = pWorker->deque.Take();
+    }
+
+    if ((pTask == nullptr) && (m_injectQueue.TryPop(&pTask) == false))
+    {
+        pTask = nullptr;
+    }
+
+    if ((pTask == nullptr) && (m_numWorkers > 0))
+    {
+        pTask = StealTask((pWorker != nullptr) ? pWorker->nextVictim++ : 0);
+    }
+
+    return pTask;
+}
+
+// =====================================================================================================================
+// Makes one steal attempt from each worker, starting at the given one.
+template<typename Allocator>
+Task* TaskPool<Allocator>::StealTask(
+    uint32 firstVictim)
+{
+    Task* pTask = nullptr;
+
+    for (uint32 i = 0; (pTask == nullptr) && (i < m_numWorkers); ++i)
+    {
+        pTask = m_pWorkers[(firstVictim + i) % m_numWorkers].deque.Steal();
+    }
+
+    return pTask;
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+void TaskPool<Allocator>::RunTask(
+    Task* pTask)
+{
+    // The task function may free or reuse the task, so read everything we need from it first.
+    TaskGroup*const pGroup = pTask->pGroup;
+
+    pTask->pfnExecute(pTask->pArg);
+
+    // The group may be destroyed as soon as its count reaches zero, so it must not be touched after the decrement.
+    if ((pGroup != nullptr) && (pGroup->m_numPending.fetch_sub(1, std::memory_order_seq_cst) == 1))
+    {
+        // We can't tell which group each sleeping Wait() is for, so wake all of them.  Nobody sleeps in Wait() while
+        // there is work to help with, so a busy pool never pays for this.
+        if (m_numWaiters.load(std::memory_order_seq_cst) > 0)
+        {
+            MutexAuto lock(&m_waitLock);
+            m_waitCondition.WakeAll();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Called after queueing a task.  The fence pairs with the one implied by a worker's increment of m_numSleepers (or a
+// waiter's increment of m_numWaiters): either we see the sleeper or it sees our task.  Threads sleeping in Wait() are
+// only woken if no worker is idle, since their own tasks may be all that keeps the workers busy.
+template<typename Allocator>
+void TaskPool<Allocator>::WakeWorker()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_numSleepers.load(std::memory_order_relaxed) > 0)
+    {
+        m_wakeSemaphore.Post();
+    }
+    else if (m_numWaiters.load(std::memory_order_relaxed) > 0)
+    {
+        MutexAuto lock(&m_waitLock);
+        m_waitCondition.WakeAll();
+    }
+}
+
+} // Util
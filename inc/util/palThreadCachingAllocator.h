@@ -0,0 +1,152 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palThreadCachingAllocator.h
+ * @brief PAL utility ThreadCachingAllocator class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+#include "palAllocShard.h"
+#include "palMutex.h"
+#include "palSysMemory.h"
+
+namespace Util
+{
+
+/// Allocation counters ThreadCachingAllocator keeps for each SystemAllocType.
+struct ThreadCachingAllocatorStats
+{
+    uint64 allocCount;  ///< Number of allocations requested.
+    uint64 allocBytes;  ///< Number of bytes requested.
+    uint64 cacheHits;   ///< Number of allocations served from a cache without calling the wrapped allocator.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Thread-caching small-object allocator.
+ *
+ * Wraps another allocator (normally a ForwardAllocator calling the client's AllocCallbacks) and keeps freed blocks of
+ * up to MaxCachedSize bytes in per-size-class free lists so that they can be handed out again without calling into
+ * the client.  The caches are split into a handful of shards, each with its own lock; every thread is assigned a shard
+ * the first time it uses the allocator, so the locks are effectively per-thread unless more threads than shards are
+ * allocating at once.  When a size class of a shard holds more than its share of memory, half of its blocks are
+ * returned to the wrapped allocator; Trim() returns all of them.
+ *
+ * Every block carries a small header in front of the client memory, so larger or over-aligned requests also go through
+ * this allocator and are simply forwarded.
+ ***********************************************************************************************************************
+ */
+template <typename Allocator>
+class ThreadCachingAllocator
+{
+public:
+    /// Largest client allocation size which is cached, in bytes.
+    static constexpr size_t MaxCachedSize = 4096 - 16;
+
+    /// Number of entries in the array filled by GetStats(): one per SystemAllocType, plus one for unknown types.
+    static constexpr uint32 NumStatsTypes = NumAllocTypeStats;
+
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator which provides the memory being cached.
+    explicit ThreadCachingAllocator(Allocator* pAllocator);
+    ~ThreadCachingAllocator();
+
+    /// Allocates a block of memory, from a cache if possible.
+    ///
+    /// @param [in] allocInfo Contains information about the requested allocation.
+    ///
+    /// @returns Pointer to the allocated memory, nullptr if the allocation failed.
+    void* Alloc(const AllocInfo& allocInfo);
+
+    /// Frees a block of memory allocated by this allocator, keeping it cached if it is small.
+    ///
+    /// @param [in] freeInfo Contains information about the requested free.
+    void Free(const FreeInfo& freeInfo);
+
+    /// Returns every cached block to the wrapped allocator.  Blocks which are still in use are not affected.
+    void Trim();
+
+    /// Returns the allocation counters for each SystemAllocType, summed across all shards.
+    ///
+    /// @param [out] pStats Indexed by (allocType - AllocObject); the last entry collects any unknown allocation type.
+    void GetStats(ThreadCachingAllocatorStats (*pStats)[NumStatsTypes]) const;
+
+private:
+    // Header stored directly in front of the client memory of every block.
+    struct BlockHeader
+    {
+        void*  pBase;      // Pointer returned by the wrapped allocator.  Links free blocks while cached.
+        uint32 sizeClass;  // Size class of the block, or UncachedClass.
+        uint32 reserved;
+    };
+
+    static constexpr size_t HeaderSize       = 16;
+    static constexpr uint32 NumSizeClasses   = 15;         // 32, 48, 64, 96, ..., 3072, 4096 bytes with the header.
+    static constexpr uint32 UncachedClass    = UINT32_MAX;
+    static constexpr size_t MaxBytesPerClass = 16 * 1024;  // Memory one size class of one shard may hold.
+    static constexpr uint32 NumShards        = 8;
+
+    static_assert(sizeof(BlockHeader) == HeaderSize, "BlockHeader must keep the client memory 16-byte aligned.");
+
+    struct FreeList
+    {
+        BlockHeader* pHead;  // Most recently freed block.
+        uint32       count;  // Number of blocks in the list.
+    };
+
+    struct alignas(PAL_CACHE_LINE_BYTES) Shard
+    {
+        Mutex                       mutex;                      // Serializes access to the members below.
+        FreeList                    freeLists[NumSizeClasses];  // Cached blocks of each size class.
+        ThreadCachingAllocatorStats stats[NumStatsTypes];       // Allocation counters of threads using this shard.
+    };
+
+    static uint32 SizeClass(size_t blockSize);
+    static size_t ClassSize(uint32 sizeClass);
+    static uint32 MaxCachedBlocks(uint32 sizeClass)
+        { return Max<uint32>(4, static_cast<uint32>(MaxBytesPerClass / ClassSize(sizeClass))); }
+
+    void FreeBlockList(BlockHeader* pList);
+
+    // Builds the FreeInfo for returning a block to the wrapped allocator.
+#if PAL_MEMTRACK
+    static FreeInfo BaseFreeInfo(void* pBase) { return FreeInfo(pBase, MemBlkType::Malloc); }
+#else
+    static FreeInfo BaseFreeInfo(void* pBase) { return FreeInfo(pBase); }
+#endif
+
+    Allocator*const m_pAllocator;         // Allocator which provides the memory being cached.
+    mutable Shard   m_shards[NumShards];  // Caches and counters, selected by CurrentThreadShardIndex().
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(ThreadCachingAllocator);
+    PAL_DISALLOW_DEFAULT_CTOR(ThreadCachingAllocator);
+};
+
+} // Util
@@ -0,0 +1,279 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palThreadCachingAllocatorImpl.h
+ * @brief PAL utility ThreadCachingAllocator class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palThreadCachingAllocator.h"
+#include "palInlineFuncs.h"
+
+#include <cstring>
+
+namespace Util
+{
+
+// =====================================================================================================================
+template <typename Allocator>
+ThreadCachingAllocator<Allocator>::ThreadCachingAllocator(
+    Allocator* pAllocator)
+    :
+    m_pAllocator(pAllocator)
+{
+    for (uint32 shard = 0; shard < NumShards; ++shard)
+    {
+        memset(&m_shards[shard].freeLists[0], 0, sizeof(m_shards[shard].freeLists));
+        memset(&m_shards[shard].stats[0], 0, sizeof(m_shards[shard].stats));
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+ThreadCachingAllocator<Allocator>::~ThreadCachingAllocator()
+{
+    Trim();
+}
+
+// =====================================================================================================================
+// Returns the smallest size class whose blocks hold blockSize bytes (including the header).  The classes alternate
+// between powers of two and 1.5 times powers of two, starting at 32 bytes.
+template <typename Allocator>
+uint32 ThreadCachingAllocator<Allocator>::SizeClass(
+    size_t blockSize)
+{
+    PAL_ASSERT(blockSize <= ClassSize(NumSizeClasses - 1));
+
+    uint32 sizeClass = 0;
+
+    if (blockSize > 32)
+    {
+        // 2^log2 < blockSize <= 2^(log2 + 1)
+        const uint32 log2 = Log2(static_cast<uint32>(blockSize - 1));
+
+        sizeClass = (blockSize <= (size_t(3) << (log2 - 1))) ? ((2 * (log2 - 5)) + 1) : (2 * (log2 - 4));
+    }
+
+    return sizeClass;
+}
+
+// =====================================================================================================================
+// Returns the size of the blocks of a size class, including the header.
+template <typename Allocator>
+size_t ThreadCachingAllocator<Allocator>::ClassSize(
+    uint32 sizeClass)
+{
+    return ((sizeClass & 1) ? size_t(3) : size_t(2)) << ((sizeClass / 2) + 4);
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void* ThreadCachingAllocator<Allocator>::Alloc(
+    const AllocInfo& allocInfo)
+{
+    // Allocating zero bytes of memory results in undefined behavior.
+    PAL_ASSERT(allocInfo.bytes > 0);
+
+    const bool   cacheable  = (allocInfo.bytes <= MaxCachedSize) && (allocInfo.alignment <= HeaderSize);
+    const uint32 sizeClass  = cacheable ? SizeClass(allocInfo.bytes + HeaderSize) : UncachedClass;
+    Shard*const  pShard     = &m_shards[CurrentThreadShardIndex(NumShards)];
+    BlockHeader* pHeader    = nullptr;
+
+    {
+        MutexAuto lock(&pShard->mutex);
+
+        ThreadCachingAllocatorStats*const pStats = &pShard->stats[AllocTypeStatsIndex(allocInfo.allocType)];
+        pStats->allocCount++;
+        pStats->allocBytes += allocInfo.bytes;
+
+        if (cacheable && (pShard->freeLists[sizeClass].pHead != nullptr))
+        {
+            FreeList*const pFreeList = &pShard->freeLists[sizeClass];
+
+            pHeader          = pFreeList->pHead;
+            pFreeList->pHead = static_cast<BlockHeader*>(pHeader->pBase);
+            pFreeList->count--;
+            pStats->cacheHits++;
+
+            pHeader->pBase = pHeader;
+        }
+    }
+
+    if (pHeader == nullptr)
+    {
+        // Cached blocks are always exactly one size class in size; anything else needs room for the header in front of
+        // the aligned client memory.
+        const size_t    alignment = Max(allocInfo.alignment, HeaderSize);
+        const size_t    bytes     = cacheable ? ClassSize(sizeClass) : (allocInfo.bytes + HeaderSize + alignment);
+#if PAL_MEMTRACK
+        const AllocInfo baseInfo(bytes, HeaderSize, false, allocInfo.allocType, MemBlkType::Malloc,
+                                 allocInfo.pFilename, allocInfo.lineNumber);
+#else
+        const AllocInfo baseInfo(bytes, HeaderSize, false, allocInfo.allocType);
+#endif
+
+        void*const pBase = m_pAllocator->Alloc(baseInfo);
+
+        if (pBase != nullptr)
+        {
+            pHeader = cacheable ? static_cast<BlockHeader*>(pBase)
+                                : static_cast<BlockHeader*>(VoidPtrDec(
+                                      VoidPtrAlign(VoidPtrInc(pBase, HeaderSize), alignment), HeaderSize));
+            pHeader->pBase     = pBase;
+            pHeader->sizeClass = sizeClass;
+        }
+    }
+
+    void* pMem = nullptr;
+
+    if (pHeader != nullptr)
+    {
+        pMem = VoidPtrInc(pHeader, HeaderSize);
+
+        if (allocInfo.zeroMem)
+        {
+            memset(pMem, 0, allocInfo.bytes);
+        }
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ThreadCachingAllocator<Allocator>::Free(
+    const FreeInfo& freeInfo)
+{
+    if (freeInfo.pClientMem != nullptr)
+    {
+        BlockHeader*const pHeader = static_cast<BlockHeader*>(VoidPtrDec(freeInfo.pClientMem, HeaderSize));
+
+        if (pHeader->sizeClass == UncachedClass)
+        {
+            m_pAllocator->Free(BaseFreeInfo(pHeader->pBase));
+        }
+        else
+        {
+            PAL_ASSERT(pHeader->pBase == pHeader);
+
+            const uint32 sizeClass = pHeader->sizeClass;
+            Shard*const  pShard    = &m_shards[CurrentThreadShardIndex(NumShards)];
+            BlockHeader* pSurplus  = nullptr;
+
+            {
+                MutexAuto lock(&pShard->mutex);
+
+                FreeList*const pFreeList = &pShard->freeLists[sizeClass];
+
+                pHeader->pBase   = pFreeList->pHead;
+                pFreeList->pHead = pHeader;
+                pFreeList->count++;
+
+                // Once the class holds more than its share, detach the older half of its blocks so they can be given
+                // back to the client outside of the lock.
+                if (pFreeList->count > MaxCachedBlocks(sizeClass))
+                {
+                    BlockHeader* pLast = pFreeList->pHead;
+
+                    for (uint32 i = 1; i < (pFreeList->count / 2); ++i)
+                    {
+                        pLast = static_cast<BlockHeader*>(pLast->pBase);
+                    }
+
+                    pSurplus         = static_cast<BlockHeader*>(pLast->pBase);
+                    pLast->pBase     = nullptr;
+                    pFreeList->count = pFreeList->count / 2;
+                }
+            }
+
+            FreeBlockList(pSurplus);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Gives a list of cached blocks back to the wrapped allocator.
+template <typename Allocator>
+void ThreadCachingAllocator<Allocator>::FreeBlockList(
+    BlockHeader* pList)
+{
+    while (pList != nullptr)
+    {
+        BlockHeader*const pNext = static_cast<BlockHeader*>(pList->pBase);
+
+        m_pAllocator->Free(BaseFreeInfo(pList));
+        pList = pNext;
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ThreadCachingAllocator<Allocator>::Trim()
+{
+    for (uint32 shard = 0; shard < NumShards; ++shard)
+    {
+        for (uint32 sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+        {
+            BlockHeader* pList = nullptr;
+
+            {
+                MutexAuto lock(&m_shards[shard].mutex);
+
+                pList = m_shards[shard].freeLists[sizeClass].pHead;
+
+                m_shards[shard].freeLists[sizeClass].pHead = nullptr;
+                m_shards[shard].freeLists[sizeClass].count = 0;
+            }
+
+            FreeBlockList(pList);
+        }
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void ThreadCachingAllocator<Allocator>::GetStats(
+    ThreadCachingAllocatorStats (*pStats)[NumStatsTypes]
+    ) const
+{
+    memset(pStats, 0, sizeof(*pStats));
+
+    for (uint32 shard = 0; shard < NumShards; ++shard)
+    {
+        MutexAuto lock(&m_shards[shard].mutex);
+
+        for (uint32 type = 0; type < NumStatsTypes; ++type)
+        {
+            (*pStats)[type].allocCount += m_shards[shard].stats[type].allocCount;
+            (*pStats)[type].allocBytes += m_shards[shard].stats[type].allocBytes;
+            (*pStats)[type].cacheHits  += m_shards[shard].stats[type].cacheHits;
+        }
+    }
+}
+
+} // Util
@@ -0,0 +1,159 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palTlsfAllocator.h
+ * @brief PAL utility TlsfAllocator class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+#include "palHashMap.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Two-level segregated fit (TLSF) allocator.
+ *
+ * Responsible for managing GPU memory requests by dividing a large base allocation into appropriately sized
+ * suballocation blocks. It has the same interface as @ref BestFitAllocator but allocates and frees in constant time.
+ *
+ * Free blocks are kept in segregated free lists. The first level splits sizes by power of two. The second level splits
+ * each power-of-two range into 2^SlBits linear classes. Two bitmaps track which lists are non-empty, so a suitable free
+ * block can be found with two bit scans. Every block links to its physical neighbours so that freed blocks can be
+ * coalesced without a search. Unlike a CPU heap the managed memory is not CPU-accessible, so all block metadata is
+ * kept out-of-band and busy blocks are looked up by offset through a hash map.
+ *
+ * @warning The TLSF allocator is not thread-safe so thread-safety has to be handled on the caller side.
+ ***********************************************************************************************************************
+ */
+template<typename Allocator>
+class TlsfAllocator
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in]  pAllocator     The allocator that will allocate memory if required.
+    /// @param [in]  baseAllocSize  The size of the base allocation this allocator suballocates.
+    ///                             Must be a power of two.
+    /// @param [in]  minAllocSize   The size of the smallest block this allocator can allocate.
+    ///                             Must be a power of two.
+    TlsfAllocator(
+        Allocator* pAllocator,
+        gpusize    baseAllocSize,
+        gpusize    minAllocSize);
+    ~TlsfAllocator();
+
+    /// Initializes the allocator.
+    ///
+    /// @returns Success if the allocator has been successfully initialized.
+    Result Init();
+
+    /// Suballocates a block from the base allocation that this allocator manages.
+    ///
+    /// @param [in]  size           The size of the requested suballocation.
+    /// @param [in]  alignment      The alignment requirements of the requested suballocation.
+    /// @param [out] pOffset        The offset the suballocated block starts within the base allocation.
+    ///
+    /// @returns Success if the allocation succeeded, @ref ErrorOutOfMemory if there isn't enough system memory to
+    ///          fulfill the request, or @ref ErrorOutOfGpuMemory if there isn't a large enough block free in the
+    ///          base allocation to fulfill the request.
+    Result Allocate(
+        gpusize  size,
+        gpusize  alignment,
+        gpusize* pOffset);
+
+    /// Frees a previously allocated suballocation.
+    ///
+    /// @param [in]  offset         The offset the suballocated block starts within the base allocation.
+    /// @param [in]  size           Optional parameter specifying the size of the original allocation.
+    /// @param [in]  alignment      Optional parameter specifying the alignment of the original allocation.
+    void Free(
+        gpusize offset,
+        gpusize size = 0,
+        gpusize alignment = 0);
+
+    /// Tells whether the base allocation is completely free. If the returned value is true then the caller is safe
+    /// to deallocate the base allocation.
+    bool IsEmpty() const { return (m_freeBytes == m_totalBytes); }
+
+    /// Returns the size of the largest allocation that can be suballocated with this allocator.
+    gpusize MaximumAllocationSize() const { return m_totalBytes; }
+
+private:
+    struct Block
+    {
+        gpusize offset;     // Offset in bytes from the base allocation address where this block begins
+        gpusize size;       // Size in bytes of the block
+        Block*  pPrevPhys;  // The block which ends where this block begins
+        Block*  pNextPhys;  // The block which begins where this block ends
+        Block*  pPrevFree;  // Previous block in this block's free list, only valid if the block isn't busy
+        Block*  pNextFree;  // Next block in this block's free list, only valid if the block isn't busy
+        bool    isBusy;     // Indicates the in-use status of the block
+    };
+
+    // Each power-of-two size range is split into 2^SlBits second level size classes. Sizes below SlCount granules
+    // are all mapped linearly into the first first-level class.
+    static constexpr uint32 SlBits  = 4;
+    static constexpr uint32 SlCount = (1u << SlBits);
+    static constexpr uint32 FlCount = (64 - SlBits + 1);
+
+    typedef HashMap<gpusize, Block*, Allocator, JenkinsHashFunc> BusyBlockMap;
+
+    void MapSize(gpusize granules, uint32* pFl, uint32* pSl) const;
+
+    Block* FindFreeBlock(gpusize size, gpusize alignment) const;
+    void   InsertFreeBlock(Block* pBlock);
+    void   RemoveFreeBlock(Block* pBlock);
+
+    Block* CreateBlock();
+    void   DestroyBlock(Block* pBlock);
+
+    void SanityCheck() const;
+
+    Allocator* const m_pAllocator;
+    gpusize    const m_totalBytes;
+    gpusize    const m_minBlockSize;
+    uint32     const m_minBlockShift;  // Log2 of m_minBlockSize; converts sizes to granules.
+    gpusize          m_freeBytes;
+
+    uint64           m_flBitmap;                     // Bit fl is set if any second level list under fl is non-empty.
+    uint32           m_slBitmap[FlCount];            // Bit sl of m_slBitmap[fl] is set if m_pFreeLists[fl][sl] is
+                                                     // non-empty.
+    Block*           m_pFreeLists[FlCount][SlCount]; // Heads of the segregated free lists.
+
+    Block*           m_pFirstBlock;    // The block at offset zero, the head of the physical block list.
+    Block*           m_pSpareBlocks;   // Retired block structs kept for reuse, linked through pNextFree.
+    BusyBlockMap     m_busyBlocks;     // Maps a busy block's offset to the block.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(TlsfAllocator);
+    PAL_DISALLOW_DEFAULT_CTOR(TlsfAllocator);
+};
+
+} // Util
@@ -0,0 +1,556 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palTlsfAllocatorImpl.h
+ * @brief PAL utility TlsfAllocator class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palTlsfAllocator.h"
+#include "palHashMapImpl.h"
+#include "palInlineFuncs.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Computes the number of hash map buckets needed to track every possible busy block without long bucket chains.
+inline uint32 TlsfBusyBucketsNeeded(
+    gpusize baseAllocSize,
+    gpusize minAllocSize)
+{
+    const gpusize maxBusyBlocks = Min<gpusize>(baseAllocSize / minAllocSize, UINT32_MAX);
+
+    return static_cast<uint32>(maxBusyBlocks / (PAL_CACHE_LINE_BYTES * 8)) + 1;
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+TlsfAllocator<Allocator>::TlsfAllocator(
+    Allocator* pAllocator,
+    gpusize    baseAllocSize,
+    gpusize    minAllocSize)
+    :
+    m_pAllocator(pAllocator),
+    m_totalBytes(baseAllocSize),
+    m_minBlockSize(minAllocSize),
+    m_minBlockShift(Log2(minAllocSize)),
+    m_freeBytes(baseAllocSize),
+    m_flBitmap(0),
+    m_slBitmap{},
+    m_pFreeLists{},
+    m_pFirstBlock(nullptr),
+    m_pSpareBlocks(nullptr),
+    m_busyBlocks(TlsfBusyBucketsNeeded(baseAllocSize, minAllocSize), pAllocator)
+{
+    // Allocator must be non-null
+    PAL_ASSERT(m_pAllocator != nullptr);
+
+    // baseAllocSize and minAllocSize must be POT
+    PAL_ASSERT(IsPowerOfTwo(baseAllocSize) && IsPowerOfTwo(minAllocSize));
+
+    // baseAllocSize must be aligned to minAllocsize
+    PAL_ASSERT((baseAllocSize % minAllocSize) == 0);
+}
+
+// =====================================================================================================================
+template<typename Allocator>
+TlsfAllocator<Allocator>::~TlsfAllocator()
+{
+    if (m_pFirstBlock != nullptr)
+    {
+        SanityCheck();
+
+        // If we don't have a single block that isn't busy, then the user didn't free all of the memory
+        PAL_ALERT(IsEmpty() == false);
+
+        for (Block* pBlock = m_pFirstBlock; pBlock != nullptr; )
+        {
+            Block* pNext = pBlock->pNextPhys;
+            PAL_DELETE(pBlock, m_pAllocator);
+            pBlock = pNext;
+        }
+    }
+
+    while (m_pSpareBlocks != nullptr)
+    {
+        Block* pNext = m_pSpareBlocks->pNextFree;
+        PAL_DELETE(m_pSpareBlocks, m_pAllocator);
+        m_pSpareBlocks = pNext;
+    }
+}
+
+// =====================================================================================================================
+// Initializes the TLSF allocator.
+template<typename Allocator>
+Result TlsfAllocator<Allocator>::Init()
+{
+    Result result = m_busyBlocks.Init();
+
+    if (result == Result::Success)
+    {
+        m_pFirstBlock = CreateBlock();
+
+        if (m_pFirstBlock != nullptr)
+        {
+            m_pFirstBlock->offset = 0;
+            m_pFirstBlock->size   = m_totalBytes;
+            InsertFreeBlock(m_pFirstBlock);
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Maps a size, in units of the minimum block size, to its first and second level size class.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::MapSize(
+    gpusize granules,
+    uint32* pFl,
+    uint32* pSl
+    ) const
+{
+    if (granules < SlCount)
+    {
+        *pFl = 0;
+        *pSl = static_cast<uint32>(granules);
+    }
+    else
+    {
+        const uint32 log2 = Log2(granules);
+
+        *pFl = log2 - SlBits + 1;
+        *pSl = static_cast<uint32>(granules >> (log2 - SlBits)) - SlCount;
+    }
+}
+
+// =====================================================================================================================
+// Finds a free block which can hold an allocation of the given size and alignment, or returns null if there is none.
+template<typename Allocator>
+typename TlsfAllocator<Allocator>::Block* TlsfAllocator<Allocator>::FindFreeBlock(
+    gpusize size,
+    gpusize alignment
+    ) const
+{
+    Block* pBlock = nullptr;
+
+    // Round the request (plus the worst case alignment padding) up to the next size class so that every block in the
+    // first non-empty list at or above that class is guaranteed to fit. This is the constant-time "good fit" search.
+    gpusize searchGranules = (size + alignment - m_minBlockSize) >> m_minBlockShift;
+
+    if (searchGranules >= SlCount)
+    {
+        searchGranules += (gpusize(1) << (Log2(searchGranules) - SlBits)) - 1;
+    }
+
+    uint32 fl = 0;
+    uint32 sl = 0;
+    MapSize(searchGranules, &fl, &sl);
+
+    if (fl < FlCount)
+    {
+        uint32 slMap = m_slBitmap[fl] & (UINT32_MAX << sl);
+
+        if (slMap == 0)
+        {
+            const uint64 flMap = ((fl + 1) < 64) ? (m_flBitmap & (UINT64_MAX << (fl + 1))) : 0;
+
+            if (BitMaskScanForward(&fl, flMap))
+            {
+                slMap = m_slBitmap[fl];
+            }
+        }
+
+        if (BitMaskScanForward(&sl, slMap))
+        {
+            pBlock = m_pFreeLists[fl][sl];
+        }
+    }
+
+    if (pBlock == nullptr)
+    {
+        // Rounding up can skip blocks which would have fit, which matters most when the heap is nearly full. Fall back
+        // to checking the blocks in the request's own size class.
+        MapSize(size >> m_minBlockShift, &fl, &sl);
+
+        for (Block* pCandidate = m_pFreeLists[fl][sl]; pCandidate != nullptr; pCandidate = pCandidate->pNextFree)
+        {
+            const gpusize padding = Pow2Align(pCandidate->offset, alignment) - pCandidate->offset;
+
+            if (pCandidate->size >= (size + padding))
+            {
+                pBlock = pCandidate;
+                break;
+            }
+        }
+    }
+
+    return pBlock;
+}
+
+// =====================================================================================================================
+// Pushes a free block onto the head of its size class's free list.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::InsertFreeBlock(
+    Block* pBlock)
+{
+    uint32 fl = 0;
+    uint32 sl = 0;
+    MapSize(pBlock->size >> m_minBlockShift, &fl, &sl);
+
+    pBlock->isBusy    = false;
+    pBlock->pPrevFree = nullptr;
+    pBlock->pNextFree = m_pFreeLists[fl][sl];
+
+    if (pBlock->pNextFree != nullptr)
+    {
+        pBlock->pNextFree->pPrevFree = pBlock;
+    }
+
+    m_pFreeLists[fl][sl] = pBlock;
+    m_slBitmap[fl]      |= (1u << sl);
+    m_flBitmap          |= (uint64(1) << fl);
+}
+
+// =====================================================================================================================
+// Unlinks a free block from its size class's free list.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::RemoveFreeBlock(
+    Block* pBlock)
+{
+    PAL_ASSERT(pBlock->isBusy == false);
+
+    uint32 fl = 0;
+    uint32 sl = 0;
+    MapSize(pBlock->size >> m_minBlockShift, &fl, &sl);
+
+    if (pBlock->pPrevFree != nullptr)
+    {
+        pBlock->pPrevFree->pNextFree = pBlock->pNextFree;
+    }
+    else
+    {
+        PAL_ASSERT(m_pFreeLists[fl][sl] == pBlock);
+        m_pFreeLists[fl][sl] = pBlock->pNextFree;
+
+        if (m_pFreeLists[fl][sl] == nullptr)
+        {
+            m_slBitmap[fl] &= ~(1u << sl);
+
+            if (m_slBitmap[fl] == 0)
+            {
+                m_flBitmap &= ~(uint64(1) << fl);
+            }
+        }
+    }
+
+    if (pBlock->pNextFree != nullptr)
+    {
+        pBlock->pNextFree->pPrevFree = pBlock->pPrevFree;
+    }
+
+    pBlock->pPrevFree = nullptr;
+    pBlock->pNextFree = nullptr;
+}
+
+// =====================================================================================================================
+// Returns a zeroed block struct, reusing a retired one if possible.
+template<typename Allocator>
+typename TlsfAllocator<Allocator>::Block* TlsfAllocator<Allocator>::CreateBlock()
+{
+    Block* pBlock = m_pSpareBlocks;
+
+    if (pBlock != nullptr)
+    {
+        m_pSpareBlocks = pBlock->pNextFree;
+    }
+    else
+    {
+        pBlock = PAL_NEW(Block, m_pAllocator, AllocInternal);
+    }
+
+    if (pBlock != nullptr)
+    {
+        *pBlock = {};
+    }
+
+    return pBlock;
+}
+
+// =====================================================================================================================
+// Retires a block struct which is no longer part of the physical block list.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::DestroyBlock(
+    Block* pBlock)
+{
+    pBlock->pNextFree = m_pSpareBlocks;
+    m_pSpareBlocks    = pBlock;
+}
+
+// =====================================================================================================================
+// Suballocates a block from the base allocation that this allocator manages. If no free space is found then an
+// appropriate error is returned.
+template<typename Allocator>
+Result TlsfAllocator<Allocator>::Allocate(
+    gpusize  size,
+    gpusize  alignment,
+    gpusize* pOffset)
+{
+    PAL_ASSERT(m_pFirstBlock != nullptr);
+
+    Result result = Result::Success;
+
+    size      = Pow2Align(Max(size, m_minBlockSize), m_minBlockSize);
+    alignment = Pow2Align(Max(alignment, m_minBlockSize), m_minBlockSize);
+
+    Block* pBlock = nullptr;
+
+    if (size > MaximumAllocationSize())
+    {
+        result = Result::ErrorOutOfGpuMemory;
+    }
+    else
+    {
+        pBlock = FindFreeBlock(size, alignment);
+
+        // There's no block that could hold the allocation
+        if (pBlock == nullptr)
+        {
+            result = Result::ErrorOutOfGpuMemory;
+        }
+    }
+
+    Block* pLead = nullptr;
+    Block* pTail = nullptr;
+    gpusize padding = 0;
+
+    if (result == Result::Success)
+    {
+        // Allocate the metadata for any leftover space before and after the allocation up front so that we never need
+        // to roll back a partially split block.
+        padding = Pow2Align(pBlock->offset, alignment) - pBlock->offset;
+
+        if (padding > 0)
+        {
+            pLead = CreateBlock();
+        }
+
+        if ((pBlock->size - padding) > size)
+        {
+            pTail = CreateBlock();
+        }
+
+        if (((padding > 0) && (pLead == nullptr)) || (((pBlock->size - padding) > size) && (pTail == nullptr)))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            result = m_busyBlocks.Insert(pBlock->offset + padding, pBlock);
+        }
+
+        if (result != Result::Success)
+        {
+            if (pLead != nullptr)
+            {
+                DestroyBlock(pLead);
+            }
+
+            if (pTail != nullptr)
+            {
+                DestroyBlock(pTail);
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        RemoveFreeBlock(pBlock);
+
+        if (pLead != nullptr)
+        {
+            pLead->offset    = pBlock->offset;
+            pLead->size      = padding;
+            pLead->pPrevPhys = pBlock->pPrevPhys;
+            pLead->pNextPhys = pBlock;
+
+            if (pLead->pPrevPhys != nullptr)
+            {
+                pLead->pPrevPhys->pNextPhys = pLead;
+            }
+            else
+            {
+                m_pFirstBlock = pLead;
+            }
+
+            pBlock->pPrevPhys = pLead;
+            pBlock->offset   += padding;
+            pBlock->size     -= padding;
+
+            InsertFreeBlock(pLead);
+        }
+
+        if (pTail != nullptr)
+        {
+            pTail->offset    = pBlock->offset + size;
+            pTail->size      = pBlock->size - size;
+            pTail->pPrevPhys = pBlock;
+            pTail->pNextPhys = pBlock->pNextPhys;
+
+            if (pTail->pNextPhys != nullptr)
+            {
+                pTail->pNextPhys->pPrevPhys = pTail;
+            }
+
+            pBlock->pNextPhys = pTail;
+            pBlock->size      = size;
+
+            InsertFreeBlock(pTail);
+        }
+
+        pBlock->isBusy = true;
+        m_freeBytes   -= size;
+        *pOffset       = pBlock->offset;
+    }
+
+    SanityCheck();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Frees a suballocated block making it available for future re-use.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::Free(
+    gpusize offset,
+    gpusize size,
+    gpusize alignment)
+{
+    PAL_ASSERT(m_pFirstBlock != nullptr);
+
+    PAL_ALERT(!((offset % m_minBlockSize) == 0));
+
+    Block** ppBlock = m_busyBlocks.FindKey(offset);
+
+    // The block was never allocated?
+    PAL_ASSERT(ppBlock != nullptr);
+
+    if (ppBlock != nullptr)
+    {
+        Block* pBlock = *ppBlock;
+        m_busyBlocks.Erase(offset);
+
+        // The block has to be busy
+        PAL_ALERT(!(pBlock->isBusy == true));
+
+        pBlock->isBusy = false;
+        m_freeBytes   += pBlock->size;
+
+        // try to merge with next block
+        Block* pNext = pBlock->pNextPhys;
+        if ((pNext != nullptr) && (pNext->isBusy == false))
+        {
+            RemoveFreeBlock(pNext);
+
+            pBlock->size     += pNext->size;
+            pBlock->pNextPhys = pNext->pNextPhys;
+
+            if (pBlock->pNextPhys != nullptr)
+            {
+                pBlock->pNextPhys->pPrevPhys = pBlock;
+            }
+
+            DestroyBlock(pNext);
+        }
+
+        // try to merge with previous block
+        Block* pPrev = pBlock->pPrevPhys;
+        if ((pPrev != nullptr) && (pPrev->isBusy == false))
+        {
+            RemoveFreeBlock(pPrev);
+
+            pPrev->size     += pBlock->size;
+            pPrev->pNextPhys = pBlock->pNextPhys;
+
+            if (pPrev->pNextPhys != nullptr)
+            {
+                pPrev->pNextPhys->pPrevPhys = pPrev;
+            }
+
+            DestroyBlock(pBlock);
+            pBlock = pPrev;
+        }
+
+        InsertFreeBlock(pBlock);
+    }
+
+    SanityCheck();
+}
+
+// =====================================================================================================================
+// Walks the physical block list to validate its invariants. This is a linear operation so it's only done in debug.
+template<typename Allocator>
+void TlsfAllocator<Allocator>::SanityCheck() const
+{
+#if DEBUG
+    PAL_ASSERT(m_pFirstBlock != nullptr);
+    PAL_ASSERT(m_pFirstBlock->offset == 0);
+
+    gpusize totalBytes = 0;
+    gpusize freeBytes  = 0;
+
+    for (const Block* pBlock = m_pFirstBlock; pBlock != nullptr; pBlock = pBlock->pNextPhys)
+    {
+        const Block* pNext = pBlock->pNextPhys;
+
+        if (pNext != nullptr)
+        {
+            // There should never be neighbour blocks that are both free
+            PAL_ASSERT((pBlock->isBusy == true) || (pNext->isBusy == true));
+
+            // The next block should start off where the previous one finished
+            PAL_ASSERT((pBlock->offset + pBlock->size) == pNext->offset);
+            PAL_ASSERT(pNext->pPrevPhys == pBlock);
+        }
+
+        totalBytes += pBlock->size;
+        freeBytes  += pBlock->isBusy ? 0u : pBlock->size;
+    }
+
+    // should be the same
+    PAL_ASSERT(totalBytes == m_totalBytes);
+    PAL_ASSERT(freeBytes == m_freeBytes);
+#endif
+}
+
+} // Util
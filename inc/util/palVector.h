@@ -43,6 +43,14 @@ namespace Util
 // Forward declarations.
 template<typename T, uint32 defaultCapacity, typename Allocator> class Vector;
 
+/// Trait which tells Vector that objects of type T may be relocated with a plain memory copy, i.e. that copying the
+/// bytes of an object to new storage and then forgetting the old storage (without running its destructor) is
+/// equivalent to move-constructing the new object and destroying the old one.  This holds for all trivially copyable
+/// types and for most PAL classes which don't point into themselves; such classes can opt in by specializing this
+/// trait to derive from std::true_type.
+template<typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> { };
+
 /**
  ***********************************************************************************************************************
  * @brief  Iterator for traversal of elements in Vector.
@@ -292,6 +300,26 @@ public:
     /// @returns An unsigned integer equal to the number of elements currently present in the vector.
     uint32 NumElements() const { return m_numElements; }
 
+    /// Returns the number of elements the vector can hold without allocating new storage.
+    ///
+    /// @returns An unsigned integer equal to the current capacity of the vector.
+    uint32 Capacity() const { return m_maxCapacity; }
+
+    /// Sets the capacity the vector should grow to the next time it runs out of space, if that is more than growth by
+    /// GrowthFactor would give.  Unlike Reserve(), this never allocates; it lets callers which can estimate their final
+    /// size up front skip the intermediate growth steps without paying for the memory if the estimate is never reached.
+    ///
+    /// @param [in] capacityHint Expected number of elements.
+    void SetCapacityHint(uint32 capacityHint) { m_capacityHint = capacityHint; }
+
+    /// Reduces the capacity of the vector to the number of elements it holds, releasing unused heap storage.  Elements
+    /// are moved back into the storage within the vector object if they fit.
+    ///
+    /// @warning All pointers and references to elements of a vector will be invalidated if storage is reallocated.
+    ///
+    /// @returns Result ErrorOutOfMemory if the operation failed, in which case the vector is unchanged.
+    Result ShrinkToFit();
+
     /// Returns true if the number of elements present in the vector is equal to zero.
     ///
     /// @returns True if the vector is empty.
@@ -347,6 +375,22 @@ public:
     void EraseAndSwapLast(uint32 index);
 
 private:
+    // Objects of type T can be relocated with memcpy/memmove instead of move-construct + destroy.
+    static constexpr bool IsRelocatable = IsTriviallyRelocatable<T>::value;
+
+    // The first heap allocation holds at least this many elements, so that vectors with a tiny or empty local buffer
+    // don't go through several small allocations.
+    static constexpr uint32 MinHeapCapacity = Max<uint32>(4, static_cast<uint32>(64 / sizeof(T)));
+
+    // Returns the capacity to grow to when the vector is full.
+    uint32 NextCapacity() const { return Max(m_maxCapacity * GrowthFactor, MinHeapCapacity, m_capacityHint); }
+
+    // Moves count objects from pSrc to uninitialized storage at pDst and ends the lifetime of the sources.
+    static void Relocate(T* pDst, T* pSrc, uint32 count);
+
+    // Replaces the data buffer by pNewData (which is either heap storage or the local buffer) with the given capacity.
+    void ReplaceStorage(T* pNewData, uint32 newCapacity);
+
     // This is a POD-type that exactly fits one T value.
     typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type ValueStorage;
 
@@ -354,6 +398,7 @@ private:
     T*               m_pData;                  // Pointer to the current data buffer.
     uint32           m_numElements;            // Number of elements present.
     uint32           m_maxCapacity;            // Maximum size it can hold.
+    uint32           m_capacityHint;           // Minimum capacity to grow to when the vector is full.
     Allocator*const  m_pAllocator;             // Allocator for this Vector.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(Vector);
@@ -383,6 +428,7 @@ Vector<T, defaultCapacity, Allocator>::Vector(
     m_pData(reinterpret_cast<T*>(m_data)),
     m_numElements(0),
     m_maxCapacity(defaultCapacity),
+    m_capacityHint(0),
     m_pAllocator(pAllocator)
  {
  }
@@ -419,6 +465,7 @@ Vector<T, defaultCapacity, Allocator>::Vector(
     :
     m_numElements(vector.m_numElements),
     m_maxCapacity(vector.m_maxCapacity),
+    m_capacityHint(vector.m_capacityHint),
     m_pAllocator(vector.m_pAllocator)
 {
     if (vector.m_pData == reinterpret_cast<T*>(vector.m_data)) // Local buffer
@@ -426,10 +473,12 @@ Vector<T, defaultCapacity, Allocator>::Vector(
         // Data buffer will be using storage from local buffer.
         m_pData = reinterpret_cast<T*>(m_data);
 
-        if (std::is_trivial<T>::value)
+        if constexpr (IsRelocatable)
         {
-            // Optimize trivial types by copying local buffer.
-            std::memcpy(m_pData, vector.m_pData, sizeof(T) * m_numElements);
+            // Optimize relocatable types by copying local buffer.  The dying vector must not destroy the objects
+            // whose bytes were taken over.
+            std::memcpy(static_cast<void*>(m_pData), vector.m_pData, sizeof(T) * m_numElements);
+            vector.m_numElements = 0;
         }
         else
         {
@@ -38,6 +38,51 @@
 namespace Util
 {
 
+// =====================================================================================================================
+// Moves objects to uninitialized storage, destroying the originals.  Relocatable types are simply copied bytewise.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+void Vector<T, defaultCapacity, Allocator>::Relocate(
+    T*     pDst,
+    T*     pSrc,
+    uint32 count)
+{
+    if constexpr (IsRelocatable)
+    {
+        if (count > 0)
+        {
+            std::memcpy(static_cast<void*>(pDst), pSrc, sizeof(T) * count);
+        }
+    }
+    else
+    {
+        // Destroy corpses of objects in the source buffer after moving.
+        for (uint32 idx = 0; idx < count; ++idx)
+        {
+            PAL_PLACEMENT_NEW(pDst + idx) T(Move(pSrc[idx]));
+            pSrc[idx].~T();
+        }
+    }
+}
+
+// =====================================================================================================================
+// Moves the elements to new storage, frees the old storage if it came from the heap and takes ownership of the new one.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+void Vector<T, defaultCapacity, Allocator>::ReplaceStorage(
+    T*     pNewData,
+    uint32 newCapacity)
+{
+    Relocate(pNewData, m_pData, m_numElements);
+
+    // Free data buffer if it uses storage from heap allocation.
+    if (m_pData != reinterpret_cast<T*>(m_data))
+    {
+        PAL_FREE(m_pData, m_pAllocator);
+    }
+
+    m_pData       = pNewData;
+    m_maxCapacity = newCapacity;
+}
+
 // =====================================================================================================================
 // If new capacity exceeds maximum capacity, allocates on the heap new storage for data buffer,
 // moves objects from data buffer to heap allocation and takes ownership of that allocation.
@@ -61,33 +106,39 @@ Result Vector<T, defaultCapacity, Allocator>::Reserve(
         }
         else
         {
-            T* const pNewData = static_cast<T*>(pNewMemory);
+            ReplaceStorage(static_cast<T*>(pNewMemory), newCapacity);
+        }
+    }
+
+    return result;
+}
 
-            if (std::is_trivial<T>::value)
+// =====================================================================================================================
+// Releases heap storage the vector doesn't need.  If the elements fit in the local buffer they are moved back into it,
+// otherwise they are moved into a heap allocation of the exact size.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+Result Vector<T, defaultCapacity, Allocator>::ShrinkToFit()
+{
+    Result result = Result::_Success;
+
+    if ((m_pData != reinterpret_cast<T*>(m_data)) && (m_maxCapacity > m_numElements))
+    {
+        if (m_numElements <= defaultCapacity)
+        {
+            ReplaceStorage(reinterpret_cast<T*>(m_data), defaultCapacity);
+        }
+        else
+        {
+            void* const pNewMemory = PAL_MALLOC(sizeof(T) * m_numElements, m_pAllocator, AllocInternal);
+
+            if (pNewMemory == nullptr)
             {
-                // Optimize trivial types by copying local buffer.
-                std::memcpy(pNewData, m_pData, sizeof(T) * m_numElements);
+                result = Result::ErrorOutOfMemory;
             }
             else
             {
-                // Move objects from data buffer to heap allocation.
-                // Destroy corpses of objects in data buffer after moving.
-                for (uint32 idx = 0; idx < m_numElements; ++idx)
-                {
-                    PAL_PLACEMENT_NEW(pNewData + idx) T(Move(m_pData[idx]));
-                    m_pData[idx].~T();
-                }
+                ReplaceStorage(static_cast<T*>(pNewMemory), m_numElements);
             }
-
-            // Free data buffer if it uses storage from heap allocation.
-            if (m_pData != reinterpret_cast<T*>(m_data))
-            {
-                PAL_FREE(m_pData, m_pAllocator);
-            }
-
-            // Take ownership of the heap allocation.
-            m_pData       = pNewData;
-            m_maxCapacity = newCapacity;
         }
     }
 
@@ -155,7 +206,7 @@ Result Vector<T, defaultCapacity, Allocator>::PushBack(
     // Alloc more space if push back requested when current size is at max capacity.
     if (m_numElements == m_maxCapacity)
     {
-        result = Reserve(m_numElements * GrowthFactor);
+        result = Reserve(NextCapacity());
     }
 
     if (result == Result::_Success)
@@ -181,7 +232,7 @@ Result Vector<T, defaultCapacity, Allocator>::PushBack(
     // Alloc more space if push back requested when current size is at max capacity.
     if (m_numElements == m_maxCapacity)
     {
-        result = Reserve(m_numElements * GrowthFactor);
+        result = Reserve(NextCapacity());
     }
 
     if (result == Result::_Success)
@@ -208,7 +259,7 @@ Result Vector<T, defaultCapacity, Allocator>::EmplaceBack(
     // Alloc more space if push back requested when current size is at max capacity.
     if (m_numElements == m_maxCapacity)
     {
-        result = Reserve(m_numElements * GrowthFactor);
+        result = Reserve(NextCapacity());
     }
 
     if (result == Result::_Success)
@@ -287,12 +338,16 @@ void Vector<T, defaultCapacity, Allocator>::Erase(
 {
     PAL_ASSERT(index < m_numElements);
 
-    if (std::is_trivial<T>::value)
+    if constexpr (IsRelocatable)
     {
+        m_pData[index].~T();
+
         if (index != (m_numElements - 1))
         {
-            // Optimize trivial types by copying local buffer.
-            std::memmove(m_pData + index, m_pData + index + 1, (m_numElements - 1 - index) * sizeof(T));
+            // Optimize relocatable types by shifting the tail of the buffer down in one go.
+            std::memmove(static_cast<void*>(m_pData + index),
+                         m_pData + index + 1,
+                         (m_numElements - 1 - index) * sizeof(T));
         }
     }
     else
@@ -344,8 +399,7 @@ void Vector<T, defaultCapacity, Allocator>::EraseAndSwapLast(
 
     if (index != (m_numElements - 1))
     {
-        PAL_PLACEMENT_NEW(m_pData + index) T(Move(m_pData[m_numElements - 1]));
-        m_pData[m_numElements - 1].~T();
+        Relocate(m_pData + index, m_pData + (m_numElements - 1), 1);
     }
 
     m_numElements--;
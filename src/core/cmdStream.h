@@ -263,6 +263,14 @@ public:
 
     uint32 GetNumChunks() const { return m_chunkList.NumElements(); }
 
+    // Returns an opaque value which identifies the current end of the committed command data. It only changes when
+    // commands are committed to this stream, so two equal values mean no commands were written in between.
+    uint64 GetWritePosition() const
+    {
+        const CmdStreamChunk*const pChunk = m_chunkList.Back();
+        return (pChunk == nullptr) ? 0 : ((uint64(GetNumChunks()) << 32) | pChunk->DwordsAllocated());
+    }
+
     ChunkRefList::Iter GetFwdIterator() const { return m_chunkList.Begin(); }
     CmdStreamChunk*    GetFirstChunk()  const { return m_chunkList.Front(); }
 
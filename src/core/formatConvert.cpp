@@ -0,0 +1,889 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2025 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palFormatInfo.h"
+#include "palMath.h"
+
+#include <cmath>
+
+// SSE2 is part of the x86-64 baseline, so the vector kernels don't need any additional compiler flags or a runtime
+// CPU check.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PAL_FORMAT_CONVERT_SSE2 1
+#include <emmintrin.h>
+#else
+#define PAL_FORMAT_CONVERT_SSE2 0
+#endif
+
+using namespace Util;
+using namespace Util::Math;
+
+namespace Pal
+{
+namespace Formats
+{
+
+// Number of pixels decoded into the intermediate representation at a time.
+constexpr uint32 PixelBatchSize = 64;
+
+// Intermediate representation of a single pixel in RGBA order. Non-integer formats are decoded to 32-bit floats while
+// integer formats keep their (sign-extended) 32-bit values so that no precision is lost for 32-bit channels.
+union RgbaPixel
+{
+    float  f[4];
+    uint32 u[4];
+    int32  i[4];
+};
+
+// Which intermediate representation a format is decoded to.
+enum class ConversionClass : uint32
+{
+    Unsupported,
+    Float,
+    Integer,
+};
+
+// Decodes the raw bits of a single component into the intermediate representation.
+typedef uint32 (*ComponentDecodeFunc)(uint32 bits, uint32 numBits);
+
+// Encodes a single component from the intermediate representation into its raw bits. srcSigned tells integer encoders
+// whether the intermediate value came from a Sint format; it is ignored by the other encoders.
+typedef uint32 (*ComponentEncodeFunc)(uint32 value, uint32 numBits, bool srcSigned);
+
+// Location of a single component inside of a pixel.
+struct ComponentLayout
+{
+    uint32 dword;   // DWORD of the pixel which contains the component.
+    uint32 shift;   // Bit offset of the component inside of that DWORD.
+    uint32 numBits; // Number of bits of the component, zero if the format doesn't have this component.
+};
+
+// Everything needed to decode or encode one of the two formats of a conversion.
+struct FormatCodec
+{
+    ChNumFormat         format;
+    ConversionClass     conversionClass;
+    uint32              bytesPerPixel;
+    ComponentLayout     layout[4];      // Indexed by component (X, Y, Z, W).
+    ComponentDecodeFunc pfnDecode[4];   // Indexed by component.
+    ComponentEncodeFunc pfnEncode[4];   // Indexed by component.
+    ChannelSwizzle      swizzle[4];     // Indexed by RGBA channel.
+};
+
+// =====================================================================================================================
+// Masks off everything above the low numBits bits; numBits may be 32.
+static uint32 LowBitMask(
+    uint32 numBits)
+{
+    return (numBits >= 32) ? UINT32_MAX : ((1u << numBits) - 1u);
+}
+
+// =====================================================================================================================
+// Sign-extends the low numBits bits of the given value.
+static int32 SignExtend(
+    uint32 bits,
+    uint32 numBits)
+{
+    const uint32 shift = 32 - numBits;
+    return static_cast<int32>(bits << shift) >> shift;
+}
+
+// =====================================================================================================================
+static uint32 DecodeUnorm(
+    uint32 bits,
+    uint32 numBits)
+{
+    return FloatToBits(static_cast<float>(static_cast<double>(bits) / LowBitMask(numBits)));
+}
+
+// =====================================================================================================================
+static uint32 DecodeSnorm(
+    uint32 bits,
+    uint32 numBits)
+{
+    // Both the most negative and the next larger value map to -1.0.
+    const double value = static_cast<double>(SignExtend(bits, numBits)) / LowBitMask(numBits - 1);
+    return FloatToBits(static_cast<float>(Max(value, -1.0)));
+}
+
+// =====================================================================================================================
+static uint32 DecodeUscaled(
+    uint32 bits,
+    uint32 numBits)
+{
+    return FloatToBits(static_cast<float>(bits));
+}
+
+// =====================================================================================================================
+static uint32 DecodeSscaled(
+    uint32 bits,
+    uint32 numBits)
+{
+    return FloatToBits(static_cast<float>(SignExtend(bits, numBits)));
+}
+
+// =====================================================================================================================
+static uint32 DecodeUint(
+    uint32 bits,
+    uint32 numBits)
+{
+    return bits;
+}
+
+// =====================================================================================================================
+static uint32 DecodeSint(
+    uint32 bits,
+    uint32 numBits)
+{
+    return static_cast<uint32>(SignExtend(bits, numBits));
+}
+
+// =====================================================================================================================
+static uint32 DecodeFloat(
+    uint32 bits,
+    uint32 numBits)
+{
+    return FloatToBits(FloatNumBitsToFloat32(bits, numBits));
+}
+
+// =====================================================================================================================
+static uint32 DecodeSrgb(
+    uint32 bits,
+    uint32 numBits)
+{
+    return FloatToBits(GammaToLinear(static_cast<float>(static_cast<double>(bits) / LowBitMask(numBits))));
+}
+
+// =====================================================================================================================
+static uint32 EncodeUnorm(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return FloatToUFixed(f, 0, numBits, true);
+}
+
+// =====================================================================================================================
+static uint32 EncodeSnorm(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return FloatToSFixed(f, 0, numBits, true) & LowBitMask(numBits);
+}
+
+// =====================================================================================================================
+static uint32 EncodeUscaled(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return FloatToUFixed(f, numBits, 0, false);
+}
+
+// =====================================================================================================================
+static uint32 EncodeSscaled(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return FloatToSFixed(f, numBits, 0, true) & LowBitMask(numBits);
+}
+
+// =====================================================================================================================
+static uint32 EncodeUint(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    // Negative Sint values clamp to zero; Uint values are only clamped against the maximum.
+    const bool isNegative = srcSigned && (static_cast<int32>(value) < 0);
+    return isNegative ? 0 : Min(value, LowBitMask(numBits));
+}
+
+// =====================================================================================================================
+static uint32 EncodeSint(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    const int64 maxVal   = static_cast<int64>(LowBitMask(numBits - 1));
+    const int64 minVal   = -maxVal - 1;
+    const int64 srcValue = srcSigned ? static_cast<int64>(static_cast<int32>(value)) : static_cast<int64>(value);
+    return static_cast<uint32>(Clamp<int64>(srcValue, minVal, maxVal)) & LowBitMask(numBits);
+}
+
+// =====================================================================================================================
+static uint32 EncodeFloat(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return Float32ToNumBits(f, numBits);
+}
+
+// =====================================================================================================================
+static uint32 EncodeSrgb(
+    uint32 value,
+    uint32 numBits,
+    bool   srcSigned)
+{
+    float f;
+    SetBitsToFloat(&f, value);
+    return FloatToUFixed(LinearToGamma(f), 0, numBits, true);
+}
+
+// Per-component conversion functions, indexed by NumericSupportFlags. YUV formats which reach this table have a
+// regular per-pixel layout and are treated as unsigned-normalized channels (no color space conversion is done).
+constexpr ComponentDecodeFunc DecodeFuncTable[] =
+{
+    nullptr,        // Undefined
+    &DecodeUnorm,   // Unorm
+    &DecodeSnorm,   // Snorm
+    &DecodeUscaled, // Uscaled
+    &DecodeSscaled, // Sscaled
+    &DecodeUint,    // Uint
+    &DecodeSint,    // Sint
+    &DecodeFloat,   // Float
+    &DecodeSrgb,    // Srgb
+    nullptr,        // DepthStencil
+    &DecodeUnorm,   // Yuv
+};
+
+constexpr ComponentEncodeFunc EncodeFuncTable[] =
+{
+    nullptr,        // Undefined
+    &EncodeUnorm,   // Unorm
+    &EncodeSnorm,   // Snorm
+    &EncodeUscaled, // Uscaled
+    &EncodeSscaled, // Sscaled
+    &EncodeUint,    // Uint
+    &EncodeSint,    // Sint
+    &EncodeFloat,   // Float
+    &EncodeSrgb,    // Srgb
+    nullptr,        // DepthStencil
+    &EncodeUnorm,   // Yuv
+};
+
+constexpr ConversionClass ConversionClassTable[] =
+{
+    ConversionClass::Unsupported, // Undefined
+    ConversionClass::Float,       // Unorm
+    ConversionClass::Float,       // Snorm
+    ConversionClass::Float,       // Uscaled
+    ConversionClass::Float,       // Sscaled
+    ConversionClass::Integer,     // Uint
+    ConversionClass::Integer,     // Sint
+    ConversionClass::Float,       // Float
+    ConversionClass::Float,       // Srgb
+    ConversionClass::Unsupported, // DepthStencil
+    ConversionClass::Float,       // Yuv
+};
+
+static_assert(ArrayLen(DecodeFuncTable) == static_cast<uint32>(NumericSupportFlags::Yuv) + 1,
+              "DecodeFuncTable must have an entry for every NumericSupportFlags value.");
+static_assert(ArrayLen(EncodeFuncTable) == ArrayLen(DecodeFuncTable),
+              "EncodeFuncTable must have an entry for every NumericSupportFlags value.");
+static_assert(ArrayLen(ConversionClassTable) == ArrayLen(DecodeFuncTable),
+              "ConversionClassTable must have an entry for every NumericSupportFlags value.");
+
+// =====================================================================================================================
+// Determines how (and if) the specified format can be converted on the CPU. Only formats with a regular, byte-aligned
+// per-pixel layout are supported; this excludes block-compressed, macro-pixel-packed, YUV planar and depth/stencil
+// formats. Individual planes of YUV planar images can be converted using their per-plane format.
+static ConversionClass GetConversionClass(
+    ChNumFormat format)
+{
+    const FormatInfo& info = FormatInfoTable[static_cast<size_t>(format)];
+
+    constexpr uint32 UnsupportedProperties = BitCountInaccurate | BlockCompressed | MacroPixelPacked | YuvPlanar;
+
+    ConversionClass conversionClass = ConversionClassTable[static_cast<uint32>(info.numericSupport)];
+
+    if (TestAnyFlagSet(info.properties, UnsupportedProperties) ||
+        (info.bitsPerPixel == 0)                                ||
+        (info.bitsPerPixel > 128)                               ||
+        ((info.bitsPerPixel % 8) != 0))
+    {
+        conversionClass = ConversionClass::Unsupported;
+    }
+
+    return conversionClass;
+}
+
+// =====================================================================================================================
+// Fills out the codec for one side of a conversion.
+static void InitFormatCodec(
+    SwizzledFormat format,
+    FormatCodec*   pCodec)
+{
+    const FormatInfo& info = FormatInfoTable[static_cast<size_t>(format.format)];
+    const uint32      type = static_cast<uint32>(info.numericSupport);
+
+    pCodec->format          = format.format;
+    pCodec->conversionClass = GetConversionClass(format.format);
+    pCodec->bytesPerPixel   = BytesPerPixel(format.format);
+
+    // Components are packed starting at the least-significant bit and never straddle a DWORD boundary, which matches
+    // how PackRawClearColor() lays them out.
+    uint32 bitOffset = 0;
+    for (uint32 compIdx = 0; compIdx < 4; compIdx++)
+    {
+        const uint32 numBits = info.bitCount[compIdx];
+
+        pCodec->layout[compIdx].dword   = bitOffset / 32;
+        pCodec->layout[compIdx].shift   = bitOffset % 32;
+        pCodec->layout[compIdx].numBits = numBits;
+        pCodec->pfnDecode[compIdx]      = DecodeFuncTable[type];
+        pCodec->pfnEncode[compIdx]      = EncodeFuncTable[type];
+
+        bitOffset += numBits;
+    }
+
+    // The alpha channel of sRGB formats is always linear.
+    if (info.numericSupport == NumericSupportFlags::Srgb)
+    {
+        for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+        {
+            if ((rgbaIdx == 3) &&
+                (format.swizzle.swizzle[rgbaIdx] >= ChannelSwizzle::X) &&
+                (format.swizzle.swizzle[rgbaIdx] <= ChannelSwizzle::W))
+            {
+                const uint32 compIdx = static_cast<uint32>(format.swizzle.swizzle[rgbaIdx]) -
+                                       static_cast<uint32>(ChannelSwizzle::X);
+
+                pCodec->pfnDecode[compIdx] = &DecodeUnorm;
+                pCodec->pfnEncode[compIdx] = &EncodeUnorm;
+            }
+        }
+    }
+
+    for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+    {
+        pCodec->swizzle[rgbaIdx] = format.swizzle.swizzle[rgbaIdx];
+    }
+}
+
+// =====================================================================================================================
+// Decodes an X9Y9Z9E5 pixel into RGB floats; alpha is always one.
+static void DecodeX9Y9Z9E5(
+    uint32 bits,
+    float* pComps)
+{
+    constexpr int32 MantissaBits = 9;
+    constexpr int32 ExponentBias = 15;
+
+    const int32 exponent = static_cast<int32>(bits >> 27) - ExponentBias - MantissaBits;
+    const float scale    = ldexpf(1.0f, exponent);
+
+    pComps[0] = static_cast<float>(bits         & 0x1FF) * scale;
+    pComps[1] = static_cast<float>((bits >> 9)  & 0x1FF) * scale;
+    pComps[2] = static_cast<float>((bits >> 18) & 0x1FF) * scale;
+    pComps[3] = 1.0f;
+}
+
+// =====================================================================================================================
+// Returns the layout of an X8Y8Z8W8_Unorm codec which has a vectorized kernel: 1 for RGBA (XYZW) order, 2 for BGRA
+// (ZYXW) order and 0 for everything else.
+static uint32 GetVectorUnorm8Order(
+    const FormatCodec& codec)
+{
+    uint32 order = 0;
+
+    if ((PAL_FORMAT_CONVERT_SSE2 != 0) && (codec.format == ChNumFormat::X8Y8Z8W8_Unorm) &&
+        (codec.swizzle[1] == ChannelSwizzle::Y) && (codec.swizzle[3] == ChannelSwizzle::W))
+    {
+        if ((codec.swizzle[0] == ChannelSwizzle::X) && (codec.swizzle[2] == ChannelSwizzle::Z))
+        {
+            order = 1;
+        }
+        else if ((codec.swizzle[0] == ChannelSwizzle::Z) && (codec.swizzle[2] == ChannelSwizzle::X))
+        {
+            order = 2;
+        }
+    }
+
+    return order;
+}
+
+// =====================================================================================================================
+// Returns true if the codec's raw pixels are bit-identical to the intermediate representation; i.e., four 32-bit
+// float or integer components in RGBA order.
+static bool IsIntermediateLayout(
+    const FormatCodec& codec)
+{
+    const bool isFullPrecision = (codec.format == ChNumFormat::X32Y32Z32W32_Float) ||
+                                 (codec.format == ChNumFormat::X32Y32Z32W32_Uint)  ||
+                                 (codec.format == ChNumFormat::X32Y32Z32W32_Sint);
+
+    return isFullPrecision                         &&
+           (codec.swizzle[0] == ChannelSwizzle::X) &&
+           (codec.swizzle[1] == ChannelSwizzle::Y) &&
+           (codec.swizzle[2] == ChannelSwizzle::Z) &&
+           (codec.swizzle[3] == ChannelSwizzle::W);
+}
+
+#if PAL_FORMAT_CONVERT_SSE2
+// =====================================================================================================================
+// Decodes X8Y8Z8W8_Unorm pixels four at a time.
+static void DecodeUnorm8Sse2(
+    const uint8* pSrc,
+    uint32       pixelCount,
+    bool         swapRb,
+    RgbaPixel*   pPixels)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(1.0f / 255.0f);
+
+    uint32 pixel = 0;
+    for (; (pixel + 4) <= pixelCount; pixel += 4)
+    {
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (pixel * 4)));
+        const __m128i lo16   = _mm_unpacklo_epi8(packed, zero);
+        const __m128i hi16   = _mm_unpackhi_epi8(packed, zero);
+
+        __m128 comps[4] =
+        {
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo16, zero)), scale),
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo16, zero)), scale),
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi16, zero)), scale),
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi16, zero)), scale),
+        };
+
+        for (uint32 i = 0; i < 4; i++)
+        {
+            if (swapRb)
+            {
+                comps[i] = _mm_shuffle_ps(comps[i], comps[i], _MM_SHUFFLE(3, 0, 1, 2));
+            }
+
+            _mm_storeu_ps(&pPixels[pixel + i].f[0], comps[i]);
+        }
+    }
+
+    for (; pixel < pixelCount; pixel++)
+    {
+        const uint8* pIn = pSrc + (pixel * 4);
+
+        pPixels[pixel].f[0] = static_cast<float>(pIn[swapRb ? 2 : 0]) / 255.0f;
+        pPixels[pixel].f[1] = static_cast<float>(pIn[1])              / 255.0f;
+        pPixels[pixel].f[2] = static_cast<float>(pIn[swapRb ? 0 : 2]) / 255.0f;
+        pPixels[pixel].f[3] = static_cast<float>(pIn[3])              / 255.0f;
+    }
+}
+
+// =====================================================================================================================
+// Encodes X8Y8Z8W8_Unorm pixels four at a time. Rounding and NaN handling match FloatToUFixed().
+static void EncodeUnorm8Sse2(
+    const RgbaPixel* pPixels,
+    uint32           pixelCount,
+    bool             swapRb,
+    uint8*           pDst)
+{
+    const __m128 zero  = _mm_setzero_ps();
+    const __m128 one   = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half  = _mm_set1_ps(0.5f);
+
+    for (uint32 pixel = 0; pixel < pixelCount; pixel += 4)
+    {
+        const uint32 count = Min(4u, pixelCount - pixel);
+
+        __m128i ints[4] = {};
+        for (uint32 i = 0; i < count; i++)
+        {
+            __m128 value = _mm_loadu_ps(&pPixels[pixel + i].f[0]);
+
+            if (swapRb)
+            {
+                value = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 0, 1, 2));
+            }
+
+            // MAXPS returns its second operand if either is NaN, so NaNs end up as zero like in the scalar path.
+            value   = _mm_min_ps(_mm_max_ps(value, zero), one);
+            ints[i] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), half));
+        }
+
+        const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(ints[0], ints[1]), _mm_packs_epi32(ints[2], ints[3]));
+
+        if (count == 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + (pixel * 4)), packed);
+        }
+        else
+        {
+            uint32 packedPixels[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&packedPixels[0]), packed);
+            memcpy(pDst + (pixel * 4), &packedPixels[0], count * 4);
+        }
+    }
+}
+#endif
+
+// =====================================================================================================================
+// Decodes a batch of pixels into the intermediate RGBA representation.
+static void DecodePixels(
+    const FormatCodec& codec,
+    const uint8*       pSrc,
+    uint32             pixelCount,
+    RgbaPixel*         pPixels)
+{
+    const bool isFloat = (codec.conversionClass == ConversionClass::Float);
+    const uint32 one   = isFloat ? FloatToBits(1.0f) : 1u;
+
+    if (IsIntermediateLayout(codec))
+    {
+        memcpy(pPixels, pSrc, pixelCount * sizeof(RgbaPixel));
+        pixelCount = 0;
+    }
+#if PAL_FORMAT_CONVERT_SSE2
+    else if (GetVectorUnorm8Order(codec) != 0)
+    {
+        DecodeUnorm8Sse2(pSrc, pixelCount, (GetVectorUnorm8Order(codec) == 2), pPixels);
+        pixelCount = 0;
+    }
+#endif
+
+    for (uint32 pixel = 0; pixel < pixelCount; pixel++)
+    {
+        uint32 raw[4] = {};
+        memcpy(&raw[0], pSrc + (pixel * codec.bytesPerPixel), codec.bytesPerPixel);
+
+        RgbaPixel comps = {};
+
+        if (codec.format == ChNumFormat::X9Y9Z9E5_Float)
+        {
+            DecodeX9Y9Z9E5(raw[0], &comps.f[0]);
+        }
+        else if (codec.format == ChNumFormat::X10Y10Z10W2_Float)
+        {
+            // Unsigned 6e4 floats in XYZ and an unsigned-normalized W.
+            comps.f[0] = Float10_6e4ToFloat32(raw[0]         & 0x3FF);
+            comps.f[1] = Float10_6e4ToFloat32((raw[0] >> 10) & 0x3FF);
+            comps.f[2] = Float10_6e4ToFloat32((raw[0] >> 20) & 0x3FF);
+            comps.f[3] = static_cast<float>(raw[0] >> 30) / 3.0f;
+        }
+        else
+        {
+            for (uint32 compIdx = 0; compIdx < 4; compIdx++)
+            {
+                const ComponentLayout& layout = codec.layout[compIdx];
+                if (layout.numBits != 0)
+                {
+                    const uint32 bits = (raw[layout.dword] >> layout.shift) & LowBitMask(layout.numBits);
+                    comps.u[compIdx]  = codec.pfnDecode[compIdx](bits, layout.numBits);
+                }
+            }
+        }
+
+        for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+        {
+            const ChannelSwizzle swizzle = codec.swizzle[rgbaIdx];
+
+            if ((swizzle >= ChannelSwizzle::X) && (swizzle <= ChannelSwizzle::W))
+            {
+                pPixels[pixel].u[rgbaIdx] =
+                    comps.u[static_cast<uint32>(swizzle) - static_cast<uint32>(ChannelSwizzle::X)];
+            }
+            else
+            {
+                pPixels[pixel].u[rgbaIdx] = (swizzle == ChannelSwizzle::One) ? one : 0;
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Encodes a batch of pixels from the intermediate RGBA representation. srcSigned is true if the pixels were decoded
+// from a Sint format, which determines how integer values are clamped.
+static void EncodePixels(
+    const FormatCodec& codec,
+    bool               srcSigned,
+    const RgbaPixel*   pPixels,
+    uint32             pixelCount,
+    uint8*             pDst)
+{
+    // Integer values can only be copied as-is if they don't need to be clamped between Uint and Sint.
+    const bool dstSigned = (codec.format == ChNumFormat::X32Y32Z32W32_Sint);
+
+    if (IsIntermediateLayout(codec) &&
+        ((codec.conversionClass != ConversionClass::Integer) || (srcSigned == dstSigned)))
+    {
+        memcpy(pDst, pPixels, pixelCount * sizeof(RgbaPixel));
+        pixelCount = 0;
+    }
+#if PAL_FORMAT_CONVERT_SSE2
+    else if (GetVectorUnorm8Order(codec) != 0)
+    {
+        EncodeUnorm8Sse2(pPixels, pixelCount, (GetVectorUnorm8Order(codec) == 2), pDst);
+        pixelCount = 0;
+    }
+#endif
+
+    for (uint32 pixel = 0; pixel < pixelCount; pixel++)
+    {
+        // Gather the RGBA channels into format components; components without a matching channel are written as zero.
+        RgbaPixel comps = {};
+        for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+        {
+            const ChannelSwizzle swizzle = codec.swizzle[rgbaIdx];
+
+            if ((swizzle >= ChannelSwizzle::X) && (swizzle <= ChannelSwizzle::W))
+            {
+                comps.u[static_cast<uint32>(swizzle) - static_cast<uint32>(ChannelSwizzle::X)] =
+                    pPixels[pixel].u[rgbaIdx];
+            }
+        }
+
+        uint32 raw[4] = {};
+
+        if (codec.format == ChNumFormat::X9Y9Z9E5_Float)
+        {
+            constexpr SwizzledFormat X9Y9Z9E5 =
+            {
+                ChNumFormat::X9Y9Z9E5_Float,
+                { ChannelSwizzle::X, ChannelSwizzle::Y, ChannelSwizzle::Z, ChannelSwizzle::W },
+            };
+
+            uint32 shared[4] = {};
+            ConvertColor(X9Y9Z9E5, &comps.f[0], &shared[0]);
+
+            raw[0] = shared[0] | (shared[1] << 9) | (shared[2] << 18) | (shared[3] << 27);
+        }
+        else if (codec.format == ChNumFormat::X10Y10Z10W2_Float)
+        {
+            raw[0] = Float32ToFloat10_6e4(comps.f[0])         |
+                     (Float32ToFloat10_6e4(comps.f[1]) << 10) |
+                     (Float32ToFloat10_6e4(comps.f[2]) << 20) |
+                     (FloatToUFixed(comps.f[3], 0, 2, true) << 30);
+        }
+        else
+        {
+            for (uint32 compIdx = 0; compIdx < 4; compIdx++)
+            {
+                const ComponentLayout& layout = codec.layout[compIdx];
+                if (layout.numBits != 0)
+                {
+                    const uint32 bits = codec.pfnEncode[compIdx](comps.u[compIdx], layout.numBits, srcSigned);
+                    raw[layout.dword] |= (bits & LowBitMask(layout.numBits)) << layout.shift;
+                }
+            }
+        }
+
+        memcpy(pDst + (pixel * codec.bytesPerPixel), &raw[0], codec.bytesPerPixel);
+    }
+}
+
+// =====================================================================================================================
+// Returns the byte index of each RGBA channel in a 32-bit X8Y8Z8W8 pixel or false if the swizzle doesn't map every
+// channel to a distinct component.
+static bool GetByteSwizzle(
+    const ChannelSwizzle* pSwizzle,
+    uint32*               pByteIdx)
+{
+    uint32 usedMask = 0;
+
+    for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+    {
+        if ((pSwizzle[rgbaIdx] >= ChannelSwizzle::X) && (pSwizzle[rgbaIdx] <= ChannelSwizzle::W))
+        {
+            pByteIdx[rgbaIdx] = static_cast<uint32>(pSwizzle[rgbaIdx]) - static_cast<uint32>(ChannelSwizzle::X);
+            usedMask         |= (1u << pByteIdx[rgbaIdx]);
+        }
+    }
+
+    return (usedMask == 0xF);
+}
+
+// =====================================================================================================================
+// Returns true if the format is one of the 4x8-bit formats that have a dedicated kernel.
+static bool IsX8Y8Z8W8(
+    ChNumFormat format)
+{
+    return (format == ChNumFormat::X8Y8Z8W8_Unorm) || (format == ChNumFormat::X8Y8Z8W8_Srgb);
+}
+
+// =====================================================================================================================
+// Lookup tables between 8-bit sRGB and 8-bit linear unorm values. Using these is bit-exact with the generic path, since
+// both quantize the same single-precision intermediate values.
+struct SrgbTables
+{
+    uint8 toLinear[256];
+    uint8 toSrgb[256];
+
+    SrgbTables()
+    {
+        for (uint32 i = 0; i < 256; i++)
+        {
+            toLinear[i] = static_cast<uint8>(EncodeUnorm(DecodeSrgb(i, 8), 8, false));
+            toSrgb[i]   = static_cast<uint8>(EncodeSrgb(DecodeUnorm(i, 8), 8, false));
+        }
+    }
+};
+
+// =====================================================================================================================
+// Converts between X8Y8Z8W8 Unorm/Srgb pixels with any permutation of channels using one table lookup per byte.
+static void ConvertX8Y8Z8W8(
+    ChNumFormat   srcFormat,
+    ChNumFormat   dstFormat,
+    const uint32* pSrcByteIdx,
+    const uint32* pDstByteIdx,
+    const uint8*  pSrc,
+    uint32        pixelCount,
+    uint8*        pDst)
+{
+    static const SrgbTables Tables;
+
+    uint8 identity[256];
+    for (uint32 i = 0; i < 256; i++)
+    {
+        identity[i] = static_cast<uint8>(i);
+    }
+
+    const uint8* pColorTable = &identity[0];
+    if (srcFormat != dstFormat)
+    {
+        pColorTable = (srcFormat == ChNumFormat::X8Y8Z8W8_Srgb) ? &Tables.toLinear[0] : &Tables.toSrgb[0];
+    }
+
+    // Per destination byte: which source byte feeds it and which table to use. Alpha is never gamma-corrected.
+    uint32       srcByte[4];
+    const uint8* pTable[4];
+    for (uint32 rgbaIdx = 0; rgbaIdx < 4; rgbaIdx++)
+    {
+        srcByte[pDstByteIdx[rgbaIdx]] = pSrcByteIdx[rgbaIdx];
+        pTable[pDstByteIdx[rgbaIdx]]  = (rgbaIdx == 3) ? &identity[0] : pColorTable;
+    }
+
+    for (uint32 pixel = 0; pixel < pixelCount; pixel++)
+    {
+        const uint8* pIn  = pSrc + (pixel * 4);
+        uint8*       pOut = pDst + (pixel * 4);
+
+        pOut[0] = pTable[0][pIn[srcByte[0]]];
+        pOut[1] = pTable[1][pIn[srcByte[1]]];
+        pOut[2] = pTable[2][pIn[srcByte[2]]];
+        pOut[3] = pTable[3][pIn[srcByte[3]]];
+    }
+}
+
+// =====================================================================================================================
+// Determines if the specified formats can be converted by ConvertPixels().
+bool SupportsPixelConversion(
+    SwizzledFormat srcFormat,
+    SwizzledFormat dstFormat)
+{
+    const ConversionClass srcClass = GetConversionClass(srcFormat.format);
+    const ConversionClass dstClass = GetConversionClass(dstFormat.format);
+
+    // Converting between integer and non-integer formats is not well-defined.
+    return (srcClass != ConversionClass::Unsupported) && (srcClass == dstClass);
+}
+
+// =====================================================================================================================
+// Converts a contiguous run of pixels between two formats. The source swizzle selects which source components make up
+// the RGBA value of each pixel and the destination swizzle selects which destination component each RGBA channel is
+// written to, exactly as in ConvertColor().
+Result ConvertPixels(
+    SwizzledFormat srcFormat,
+    const void*    pSrc,
+    SwizzledFormat dstFormat,
+    void*          pDst,
+    uint32         pixelCount)
+{
+    Result result = Result::Success;
+
+    if ((pSrc == nullptr) || (pDst == nullptr))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (SupportsPixelConversion(srcFormat, dstFormat) == false)
+    {
+        result = Result::ErrorInvalidFormat;
+    }
+    else
+    {
+        const uint8* pSrcBytes = static_cast<const uint8*>(pSrc);
+        uint8*       pDstBytes = static_cast<uint8*>(pDst);
+
+        uint32 srcByteIdx[4] = {};
+        uint32 dstByteIdx[4] = {};
+
+        if (srcFormat == dstFormat)
+        {
+            // Decoding and re-encoding with identical formats is a no-op; the only exception would be NaN or
+            // denormal canonicalization, which raw copies aren't expected to do either.
+            memcpy(pDst, pSrc, static_cast<size_t>(pixelCount) * BytesPerPixel(srcFormat.format));
+        }
+        else if (IsX8Y8Z8W8(srcFormat.format) &&
+                 IsX8Y8Z8W8(dstFormat.format) &&
+                 GetByteSwizzle(&srcFormat.swizzle.swizzle[0], &srcByteIdx[0]) &&
+                 GetByteSwizzle(&dstFormat.swizzle.swizzle[0], &dstByteIdx[0]))
+        {
+            ConvertX8Y8Z8W8(srcFormat.format,
+                            dstFormat.format,
+                            &srcByteIdx[0],
+                            &dstByteIdx[0],
+                            pSrcBytes,
+                            pixelCount,
+                            pDstBytes);
+        }
+        else
+        {
+            FormatCodec srcCodec = {};
+            FormatCodec dstCodec = {};
+            InitFormatCodec(srcFormat, &srcCodec);
+            InitFormatCodec(dstFormat, &dstCodec);
+
+            const bool srcSigned = (FormatInfoTable[static_cast<size_t>(srcFormat.format)].numericSupport ==
+                                    NumericSupportFlags::Sint);
+
+            RgbaPixel pixels[PixelBatchSize];
+
+            for (uint32 first = 0; first < pixelCount; first += PixelBatchSize)
+            {
+                const uint32 count = Min(PixelBatchSize, pixelCount - first);
+
+                DecodePixels(srcCodec, pSrcBytes + (first * srcCodec.bytesPerPixel), count, &pixels[0]);
+                EncodePixels(dstCodec, srcSigned, &pixels[0], count, pDstBytes + (first * dstCodec.bytesPerPixel));
+            }
+        }
+    }
+
+    return result;
+}
+
+} // Formats
+} // Pal
@@ -467,1820 +467,2170 @@ void SwizzleColor(
 }
 
 // =====================================================================================================================
-// Converts format into its Unorm equivalent.
-ChNumFormat PAL_STDCALL ConvertToUnorm(
-    ChNumFormat format)
+// Lookup tables which map each format to its equivalent with a different numeric format, or to Undefined if there is no
+// such format. All of them are indexed by ChNumFormat.
+constexpr ChNumFormat UnormTable[] =
 {
-    constexpr ChNumFormat UnormTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::X1_Unorm,              // ChNumFormat::X1_Unorm
-        ChNumFormat::X1_Unorm,              // ChNumFormat::X1_Uscaled
-        ChNumFormat::X4Y4_Unorm,            // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::X4Y4_Unorm,            // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::L4A4_Unorm,            // ChNumFormat::L4A4_Unorm
-        ChNumFormat::X4Y4Z4W4_Unorm,        // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::X4Y4Z4W4_Unorm,        // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::X5Y6Z5_Unorm,          // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::X5Y6Z5_Unorm,          // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::X5Y5Z5W1_Unorm,        // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::X5Y5Z5W1_Unorm,        // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::X1Y5Z5W5_Unorm,        // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::X1Y5Z5W5_Unorm,        // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Srgb
-        ChNumFormat::A8_Unorm,              // ChNumFormat::A8_Unorm
-        ChNumFormat::L8_Unorm,              // ChNumFormat::L8_Unorm
-        ChNumFormat::P8_Unorm,              // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::L8A8_Unorm,            // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Float
-        ChNumFormat::L16_Unorm,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Bc1_Unorm,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Bc1_Unorm,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Bc2_Unorm,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Bc2_Unorm,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Bc3_Unorm,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Bc3_Unorm,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Bc4_Unorm,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Bc4_Unorm,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Bc5_Unorm,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Bc5_Unorm,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Bc7_Unorm,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Bc7_Unorm,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Etc2X8Y8Z8_Unorm,      // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Etc2X8Y8Z8_Unorm,      // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Etc2X8Y8Z8W1_Unorm,    // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Etc2X8Y8Z8W1_Unorm,    // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Etc2X8Y8Z8W8_Unorm,    // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Etc2X8Y8Z8W8_Unorm,    // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Etc2X11_Unorm,         // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Etc2X11_Unorm,         // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Etc2X11Y11_Unorm,      // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Etc2X11Y11_Unorm,      // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::AstcLdr4x4_Unorm,      // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::AstcLdr4x4_Unorm,      // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::AstcLdr5x4_Unorm,      // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::AstcLdr5x4_Unorm,      // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::AstcLdr5x5_Unorm,      // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::AstcLdr5x5_Unorm,      // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::AstcLdr6x5_Unorm,      // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::AstcLdr6x5_Unorm,      // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::AstcLdr6x6_Unorm,      // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::AstcLdr6x6_Unorm,      // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::AstcLdr8x5_Unorm,      // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::AstcLdr8x5_Unorm,      // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::AstcLdr8x6_Unorm,      // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::AstcLdr8x6_Unorm,      // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::AstcLdr8x8_Unorm,      // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::AstcLdr8x8_Unorm,      // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::AstcLdr10x5_Unorm,     // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::AstcLdr10x5_Unorm,     // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::AstcLdr10x6_Unorm,     // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::AstcLdr10x6_Unorm,     // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::AstcLdr10x8_Unorm,     // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::AstcLdr10x8_Unorm,     // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::AstcLdr10x10_Unorm,    // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::AstcLdr10x10_Unorm,    // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::AstcLdr12x10_Unorm,    // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::AstcLdr12x10_Unorm,    // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::AstcLdr12x12_Unorm,    // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::AstcLdr12x12_Unorm,    // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::X8Y8_Z8Y8_Unorm,       // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::X8Y8_Z8Y8_Unorm,       // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Y8X8_Y8Z8_Unorm,       // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Y8X8_Y8Z8_Unorm,       // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::X8_MM_Unorm,           // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::X8_MM_Unorm,           // ChNumFormat::X8_MM_Uint
-        ChNumFormat::X8Y8_MM_Unorm,         // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::X8Y8_MM_Unorm,         // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::X16_MM10_Unorm,        // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::X16_MM10_Unorm,        // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::X16Y16_MM10_Unorm,     // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::X16Y16_MM10_Unorm,     // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::X16_MM12_Unorm,        // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::X16_MM12_Unorm,        // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::X16Y16_MM12_Unorm,     // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::X16Y16_MM12_Unorm,     // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::X1_Unorm,              // ChNumFormat::X1_Unorm
+    ChNumFormat::X1_Unorm,              // ChNumFormat::X1_Uscaled
+    ChNumFormat::X4Y4_Unorm,            // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::X4Y4_Unorm,            // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::L4A4_Unorm,            // ChNumFormat::L4A4_Unorm
+    ChNumFormat::X4Y4Z4W4_Unorm,        // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::X4Y4Z4W4_Unorm,        // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::X5Y6Z5_Unorm,          // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::X5Y6Z5_Unorm,          // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::X5Y5Z5W1_Unorm,        // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::X5Y5Z5W1_Unorm,        // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::X1Y5Z5W5_Unorm,        // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::X1Y5Z5W5_Unorm,        // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Unorm,              // ChNumFormat::X8_Srgb
+    ChNumFormat::A8_Unorm,              // ChNumFormat::A8_Unorm
+    ChNumFormat::L8_Unorm,              // ChNumFormat::L8_Unorm
+    ChNumFormat::P8_Unorm,              // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Unorm,            // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::L8A8_Unorm,            // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Unorm,        // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Unorm,             // ChNumFormat::X16_Float
+    ChNumFormat::L16_Unorm,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Unorm,          // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Unorm,    // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Bc1_Unorm,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Bc1_Unorm,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Bc2_Unorm,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Bc2_Unorm,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Bc3_Unorm,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Bc3_Unorm,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Bc4_Unorm,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Bc4_Unorm,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Bc5_Unorm,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Bc5_Unorm,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Bc7_Unorm,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Bc7_Unorm,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Etc2X8Y8Z8_Unorm,      // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Etc2X8Y8Z8_Unorm,      // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Etc2X8Y8Z8W1_Unorm,    // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Etc2X8Y8Z8W1_Unorm,    // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Etc2X8Y8Z8W8_Unorm,    // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Etc2X8Y8Z8W8_Unorm,    // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Etc2X11_Unorm,         // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Etc2X11_Unorm,         // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Etc2X11Y11_Unorm,      // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Etc2X11Y11_Unorm,      // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::AstcLdr4x4_Unorm,      // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::AstcLdr4x4_Unorm,      // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::AstcLdr5x4_Unorm,      // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::AstcLdr5x4_Unorm,      // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::AstcLdr5x5_Unorm,      // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::AstcLdr5x5_Unorm,      // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::AstcLdr6x5_Unorm,      // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::AstcLdr6x5_Unorm,      // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::AstcLdr6x6_Unorm,      // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::AstcLdr6x6_Unorm,      // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::AstcLdr8x5_Unorm,      // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::AstcLdr8x5_Unorm,      // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::AstcLdr8x6_Unorm,      // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::AstcLdr8x6_Unorm,      // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::AstcLdr8x8_Unorm,      // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::AstcLdr8x8_Unorm,      // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::AstcLdr10x5_Unorm,     // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::AstcLdr10x5_Unorm,     // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::AstcLdr10x6_Unorm,     // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::AstcLdr10x6_Unorm,     // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::AstcLdr10x8_Unorm,     // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::AstcLdr10x8_Unorm,     // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::AstcLdr10x10_Unorm,    // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::AstcLdr10x10_Unorm,    // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::AstcLdr12x10_Unorm,    // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::AstcLdr12x10_Unorm,    // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::AstcLdr12x12_Unorm,    // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::AstcLdr12x12_Unorm,    // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::X8Y8_Z8Y8_Unorm,       // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::X8Y8_Z8Y8_Unorm,       // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Y8X8_Y8Z8_Unorm,       // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Y8X8_Y8Z8_Unorm,       // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::X8_MM_Unorm,           // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::X8_MM_Unorm,           // ChNumFormat::X8_MM_Uint
+    ChNumFormat::X8Y8_MM_Unorm,         // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::X8Y8_MM_Unorm,         // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::X16_MM10_Unorm,        // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::X16_MM10_Unorm,        // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::X16Y16_MM10_Unorm,     // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::X16Y16_MM10_Unorm,     // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::X16_MM12_Unorm,        // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::X16_MM12_Unorm,        // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::X16Y16_MM12_Unorm,     // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::X16Y16_MM12_Unorm,     // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Unorm,     // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(UnormTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "UnormTable does not match the number of ChNumFormats!");
-
-    return UnormTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Snorm equivalent.
-ChNumFormat PAL_STDCALL ConvertToSnorm(
-    ChNumFormat format)
+constexpr ChNumFormat SnormTable[] =
 {
-    constexpr ChNumFormat SnormTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Bc4_Snorm,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Bc4_Snorm,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Bc5_Snorm,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Bc5_Snorm,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Etc2X11_Snorm,         // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Etc2X11_Snorm,         // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Etc2X11Y11_Snorm,      // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Etc2X11Y11_Snorm,      // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Snorm,              // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Snorm,            // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Snorm,        // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Snorm,             // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Snorm,          // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Snorm,    // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Bc4_Snorm,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Bc4_Snorm,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Bc5_Snorm,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Bc5_Snorm,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Etc2X11_Snorm,         // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Etc2X11_Snorm,         // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Etc2X11Y11_Snorm,      // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Etc2X11Y11_Snorm,      // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Snorm,     // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(SnormTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "SnormTable does not match the number of ChNumFormats!");
-
-    return SnormTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Uscaled equivalent.
-ChNumFormat PAL_STDCALL ConvertToUscaled(
-    ChNumFormat format)
+constexpr ChNumFormat UscaledTable[] =
 {
-    constexpr ChNumFormat UscaledTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::X1_Uscaled,            // ChNumFormat::X1_Unorm
-        ChNumFormat::X1_Uscaled,            // ChNumFormat::X1_Uscaled
-        ChNumFormat::X4Y4_Uscaled,          // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::X4Y4_Uscaled,          // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::X4Y4Z4W4_Uscaled,      // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::X4Y4Z4W4_Uscaled,      // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::X5Y6Z5_Uscaled,        // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::X5Y6Z5_Uscaled,        // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::X5Y5Z5W1_Uscaled,      // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::X5Y5Z5W1_Uscaled,      // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::X1Y5Z5W5_Uscaled,      // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::X1Y5Z5W5_Uscaled,      // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::X8Y8_Z8Y8_Uscaled,     // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::X8Y8_Z8Y8_Uscaled,     // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Y8X8_Y8Z8_Uscaled,     // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Y8X8_Y8Z8_Uscaled,     // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::X1_Uscaled,            // ChNumFormat::X1_Unorm
+    ChNumFormat::X1_Uscaled,            // ChNumFormat::X1_Uscaled
+    ChNumFormat::X4Y4_Uscaled,          // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::X4Y4_Uscaled,          // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::X4Y4Z4W4_Uscaled,      // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::X4Y4Z4W4_Uscaled,      // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::X5Y6Z5_Uscaled,        // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::X5Y6Z5_Uscaled,        // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::X5Y5Z5W1_Uscaled,      // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::X5Y5Z5W1_Uscaled,      // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::X1Y5Z5W5_Uscaled,      // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::X1Y5Z5W5_Uscaled,      // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Uscaled,            // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Uscaled,          // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Uscaled,      // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Uscaled,           // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Uscaled,        // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Uscaled,  // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::X8Y8_Z8Y8_Uscaled,     // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::X8Y8_Z8Y8_Uscaled,     // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Y8X8_Y8Z8_Uscaled,     // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Y8X8_Y8Z8_Uscaled,     // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Uscaled,   // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(UscaledTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "UscaledTable does not match the number of ChNumFormats!");
-
-    return UscaledTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Sscaled equivalent.
-ChNumFormat PAL_STDCALL ConvertToSscaled(
-    ChNumFormat format)
+constexpr ChNumFormat SscaledTable[] =
 {
-    constexpr ChNumFormat SscaledTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Sscaled,            // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Sscaled,          // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Sscaled,      // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Sscaled,           // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Sscaled,        // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Sscaled,  // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Sscaled,   // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(SscaledTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "SscaledTable does not match the number of ChNumFormats!");
-
-    return SscaledTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Uint equivalent.
-ChNumFormat PAL_STDCALL ConvertToUint(
-    ChNumFormat format)
+constexpr ChNumFormat UintTable[] =
 {
-    constexpr ChNumFormat UintTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Uint,               // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Uint,              // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::X32_Uint,              // ChNumFormat::X32_Uint
-        ChNumFormat::X32_Uint,              // ChNumFormat::X32_Sint
-        ChNumFormat::X32_Uint,              // ChNumFormat::X32_Float
-        ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Uint
-        ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Sint
-        ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Float
-        ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::X8_MM_Uint,            // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::X8_MM_Uint,            // ChNumFormat::X8_MM_Uint
-        ChNumFormat::X8Y8_MM_Uint,          // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::X8Y8_MM_Uint,          // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::X16_MM10_Uint,         // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::X16_MM10_Uint,         // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::X16Y16_MM10_Uint,      // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::X16Y16_MM10_Uint,      // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::X16_MM12_Uint,         // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::X16_MM12_Uint,         // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::X16Y16_MM12_Uint,      // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::X16Y16_MM12_Uint,      // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Uint,               // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Uint,             // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Uint,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Uint,              // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Uint,           // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Uint,     // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::X32_Uint,              // ChNumFormat::X32_Uint
+    ChNumFormat::X32_Uint,              // ChNumFormat::X32_Sint
+    ChNumFormat::X32_Uint,              // ChNumFormat::X32_Float
+    ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Uint
+    ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Sint
+    ChNumFormat::X32Y32_Uint,           // ChNumFormat::X32Y32_Float
+    ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::X32Y32Z32_Uint,        // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::X32Y32Z32W32_Uint,     // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::X8_MM_Uint,            // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::X8_MM_Uint,            // ChNumFormat::X8_MM_Uint
+    ChNumFormat::X8Y8_MM_Uint,          // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::X8Y8_MM_Uint,          // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::X16_MM10_Uint,         // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::X16_MM10_Uint,         // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::X16Y16_MM10_Uint,      // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::X16Y16_MM10_Uint,      // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::X16_MM12_Uint,         // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::X16_MM12_Uint,         // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::X16Y16_MM12_Uint,      // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::X16Y16_MM12_Uint,      // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Uint,      // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(UintTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "UintTable does not match the number of ChNumFormats!");
-
-    return UintTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Sint equivalent.
-ChNumFormat PAL_STDCALL ConvertToSint(
-    ChNumFormat format)
+constexpr ChNumFormat SintTable[] =
 {
-    constexpr ChNumFormat SintTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Sint,               // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Sint,              // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::X32_Sint,              // ChNumFormat::X32_Uint
-        ChNumFormat::X32_Sint,              // ChNumFormat::X32_Sint
-        ChNumFormat::X32_Sint,              // ChNumFormat::X32_Float
-        ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Uint
-        ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Sint
-        ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Float
-        ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Sint,               // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Sint,             // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Sint,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Sint,              // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Sint,           // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Sint,     // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::X32_Sint,              // ChNumFormat::X32_Uint
+    ChNumFormat::X32_Sint,              // ChNumFormat::X32_Sint
+    ChNumFormat::X32_Sint,              // ChNumFormat::X32_Float
+    ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Uint
+    ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Sint
+    ChNumFormat::X32Y32_Sint,           // ChNumFormat::X32Y32_Float
+    ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::X32Y32Z32_Sint,        // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::X32Y32Z32W32_Sint,     // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Sint,      // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
-
-    static_assert(ArrayLen(SintTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "SintTable does not match the number of ChNumFormats!");
-
-    return SintTable[static_cast<size_t>(format)];
 };
 
-// =====================================================================================================================
-// Converts format into its Float equivalent.
-ChNumFormat PAL_STDCALL ConvertToFloat(
-    ChNumFormat format)
+constexpr ChNumFormat FloatTable[] =
 {
-    constexpr ChNumFormat FloatTable[] =
-    {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::X10Y11Z11_Float,       // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::X11Y11Z10_Float,       // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Unorm
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Snorm
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Uscaled
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Sscaled
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Uint
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Sint
-        ChNumFormat::X16_Float,             // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Uint
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Sint
-        ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Float
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::X32_Float,             // ChNumFormat::X32_Uint
-        ChNumFormat::X32_Float,             // ChNumFormat::X32_Sint
-        ChNumFormat::X32_Float,             // ChNumFormat::X32_Float
-        ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Uint
-        ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Sint
-        ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Float
-        ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::X9Y9Z9E5_Float,        // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Bc6_Ufloat,            // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Bc6_Sfloat,            // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::AstcHdr4x4_Float,      // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::AstcHdr5x4_Float,      // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::AstcHdr5x5_Float,      // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::AstcHdr6x5_Float,      // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::AstcHdr6x6_Float,      // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::AstcHdr8x5_Float,      // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::AstcHdr8x6_Float,      // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::AstcHdr8x8_Float,      // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::AstcHdr10x5_Float,     // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::AstcHdr10x6_Float,     // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::AstcHdr10x8_Float,     // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::AstcHdr10x10_Float,    // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::AstcHdr12x10_Float,    // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::AstcHdr12x12_Float,    // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::X10Y10Z10W2_Float,     // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::X10Y11Z11_Float,       // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::X11Y11Z10_Float,       // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Unorm
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Snorm
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Uscaled
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Sscaled
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Uint
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Sint
+    ChNumFormat::X16_Float,             // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Uint
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Sint
+    ChNumFormat::X16Y16_Float,          // ChNumFormat::X16Y16_Float
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::X16Y16Z16W16_Float,    // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::X32_Float,             // ChNumFormat::X32_Uint
+    ChNumFormat::X32_Float,             // ChNumFormat::X32_Sint
+    ChNumFormat::X32_Float,             // ChNumFormat::X32_Float
+    ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Uint
+    ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Sint
+    ChNumFormat::X32Y32_Float,          // ChNumFormat::X32Y32_Float
+    ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::X32Y32Z32_Float,       // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::X32Y32Z32W32_Float,    // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::X9Y9Z9E5_Float,        // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Bc6_Ufloat,            // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Bc6_Sfloat,            // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::AstcHdr4x4_Float,      // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::AstcHdr5x4_Float,      // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::AstcHdr5x5_Float,      // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::AstcHdr6x5_Float,      // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::AstcHdr6x6_Float,      // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::AstcHdr8x5_Float,      // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::AstcHdr8x6_Float,      // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::AstcHdr8x8_Float,      // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::AstcHdr10x5_Float,     // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::AstcHdr10x6_Float,     // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::AstcHdr10x8_Float,     // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::AstcHdr10x10_Float,    // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::AstcHdr12x10_Float,    // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::AstcHdr12x12_Float,    // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::X10Y10Z10W2_Float,     // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChNumFormat::Undefined,             // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
 #endif
-    };
+};
 
-    static_assert(ArrayLen(FloatTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "FloatTable does not match the number of ChNumFormats!");
+constexpr ChNumFormat SrgbTable[] =
+{
+    ChNumFormat::Undefined,             // ChNumFormat::Undefined
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Unorm
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Snorm
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Uscaled
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Sscaled
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Uint
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Sint
+    ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Unorm
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Snorm
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Uscaled
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Sscaled
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Uint
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Sint
+    ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Unorm
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Snorm
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Uint
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Sint
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Srgb
+    ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
+    ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
+    ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
+    ChNumFormat::Bc1_Srgb,              // ChNumFormat::Bc1_Unorm
+    ChNumFormat::Bc1_Srgb,              // ChNumFormat::Bc1_Srgb
+    ChNumFormat::Bc2_Srgb,              // ChNumFormat::Bc2_Unorm
+    ChNumFormat::Bc2_Srgb,              // ChNumFormat::Bc2_Srgb
+    ChNumFormat::Bc3_Srgb,              // ChNumFormat::Bc3_Unorm
+    ChNumFormat::Bc3_Srgb,              // ChNumFormat::Bc3_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
+    ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
+    ChNumFormat::Bc7_Srgb,              // ChNumFormat::Bc7_Unorm
+    ChNumFormat::Bc7_Srgb,              // ChNumFormat::Bc7_Srgb
+    ChNumFormat::Etc2X8Y8Z8_Srgb,       // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChNumFormat::Etc2X8Y8Z8_Srgb,       // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChNumFormat::Etc2X8Y8Z8W1_Srgb,     // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChNumFormat::Etc2X8Y8Z8W1_Srgb,     // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChNumFormat::Etc2X8Y8Z8W8_Srgb,     // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChNumFormat::Etc2X8Y8Z8W8_Srgb,     // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
+    ChNumFormat::AstcLdr4x4_Srgb,       // ChNumFormat::AstcLdr4x4_Unorm
+    ChNumFormat::AstcLdr4x4_Srgb,       // ChNumFormat::AstcLdr4x4_Srgb
+    ChNumFormat::AstcLdr5x4_Srgb,       // ChNumFormat::AstcLdr5x4_Unorm
+    ChNumFormat::AstcLdr5x4_Srgb,       // ChNumFormat::AstcLdr5x4_Srgb
+    ChNumFormat::AstcLdr5x5_Srgb,       // ChNumFormat::AstcLdr5x5_Unorm
+    ChNumFormat::AstcLdr5x5_Srgb,       // ChNumFormat::AstcLdr5x5_Srgb
+    ChNumFormat::AstcLdr6x5_Srgb,       // ChNumFormat::AstcLdr6x5_Unorm
+    ChNumFormat::AstcLdr6x5_Srgb,       // ChNumFormat::AstcLdr6x5_Srgb
+    ChNumFormat::AstcLdr6x6_Srgb,       // ChNumFormat::AstcLdr6x6_Unorm
+    ChNumFormat::AstcLdr6x6_Srgb,       // ChNumFormat::AstcLdr6x6_Srgb
+    ChNumFormat::AstcLdr8x5_Srgb,       // ChNumFormat::AstcLdr8x5_Unorm
+    ChNumFormat::AstcLdr8x5_Srgb,       // ChNumFormat::AstcLdr8x5_Srgb
+    ChNumFormat::AstcLdr8x6_Srgb,       // ChNumFormat::AstcLdr8x6_Unorm
+    ChNumFormat::AstcLdr8x6_Srgb,       // ChNumFormat::AstcLdr8x6_Srgb
+    ChNumFormat::AstcLdr8x8_Srgb,       // ChNumFormat::AstcLdr8x8_Unorm
+    ChNumFormat::AstcLdr8x8_Srgb,       // ChNumFormat::AstcLdr8x8_Srgb
+    ChNumFormat::AstcLdr10x5_Srgb,      // ChNumFormat::AstcLdr10x5_Unorm
+    ChNumFormat::AstcLdr10x5_Srgb,      // ChNumFormat::AstcLdr10x5_Srgb
+    ChNumFormat::AstcLdr10x6_Srgb,      // ChNumFormat::AstcLdr10x6_Unorm
+    ChNumFormat::AstcLdr10x6_Srgb,      // ChNumFormat::AstcLdr10x6_Srgb
+    ChNumFormat::AstcLdr10x8_Srgb,      // ChNumFormat::AstcLdr10x8_Unorm
+    ChNumFormat::AstcLdr10x8_Srgb,      // ChNumFormat::AstcLdr10x8_Srgb
+    ChNumFormat::AstcLdr10x10_Srgb,     // ChNumFormat::AstcLdr10x10_Unorm
+    ChNumFormat::AstcLdr10x10_Srgb,     // ChNumFormat::AstcLdr10x10_Srgb
+    ChNumFormat::AstcLdr12x10_Srgb,     // ChNumFormat::AstcLdr12x10_Unorm
+    ChNumFormat::AstcLdr12x10_Srgb,     // ChNumFormat::AstcLdr12x10_Srgb
+    ChNumFormat::AstcLdr12x12_Srgb,     // ChNumFormat::AstcLdr12x12_Unorm
+    ChNumFormat::AstcLdr12x12_Srgb,     // ChNumFormat::AstcLdr12x12_Srgb
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
+    ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChNumFormat::Undefined,             // ChNumFormat::AYUV
+    ChNumFormat::Undefined,             // ChNumFormat::UYVY
+    ChNumFormat::Undefined,             // ChNumFormat::VYUY
+    ChNumFormat::Undefined,             // ChNumFormat::YUY2
+    ChNumFormat::Undefined,             // ChNumFormat::YVY2
+    ChNumFormat::Undefined,             // ChNumFormat::YV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV11
+    ChNumFormat::Undefined,             // ChNumFormat::NV12
+    ChNumFormat::Undefined,             // ChNumFormat::NV21
+    ChNumFormat::Undefined,             // ChNumFormat::P016
+    ChNumFormat::Undefined,             // ChNumFormat::P010
+    ChNumFormat::Undefined,             // ChNumFormat::P210
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P208
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
+    ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
+    ChNumFormat::Undefined,             // ChNumFormat::P012
+    ChNumFormat::Undefined,             // ChNumFormat::P212
+    ChNumFormat::Undefined,             // ChNumFormat::P412
+    ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Float
+    ChNumFormat::Undefined,             // ChNumFormat::Y216
+    ChNumFormat::Undefined,             // ChNumFormat::Y210
+    ChNumFormat::Undefined,             // ChNumFormat::Y416
+    ChNumFormat::Undefined,             // ChNumFormat::Y410
+    ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
+    ChNumFormat::Undefined,             // ChNumFormat::P216
+#endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
+    ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+#endif
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
+    ChNumFormat::Undefined,             // ChNumFormat::YV16
+    ChNumFormat::Undefined,             // ChNumFormat::YV24
+    ChNumFormat::Undefined,             // ChNumFormat::NV24
+    ChNumFormat::Undefined,             // ChNumFormat::P410
+    ChNumFormat::Undefined,             // ChNumFormat::P416
+#endif
+};
 
-    return FloatTable[static_cast<size_t>(format)];
+static_assert(ArrayLen(UnormTable) == static_cast<size_t>(ChNumFormat::Count),
+              "UnormTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(SnormTable) == static_cast<size_t>(ChNumFormat::Count),
+              "SnormTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(UscaledTable) == static_cast<size_t>(ChNumFormat::Count),
+              "UscaledTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(SscaledTable) == static_cast<size_t>(ChNumFormat::Count),
+              "SscaledTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(UintTable) == static_cast<size_t>(ChNumFormat::Count),
+              "UintTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(SintTable) == static_cast<size_t>(ChNumFormat::Count),
+              "SintTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(FloatTable) == static_cast<size_t>(ChNumFormat::Count),
+              "FloatTable does not match the number of ChNumFormats!");
+static_assert(ArrayLen(SrgbTable) == static_cast<size_t>(ChNumFormat::Count),
+              "SrgbTable does not match the number of ChNumFormats!");
+
+// Conversion table for each NumericSupportFlags value, used by ConvertToDstNumFmt(). Numeric formats without a table
+// (undefined, depth/stencil and YUV) can only be "converted" to themselves.
+constexpr const ChNumFormat* NumFmtConversionTables[] =
+{
+    nullptr,        // NumericSupportFlags::Undefined
+    UnormTable,     // NumericSupportFlags::Unorm
+    SnormTable,     // NumericSupportFlags::Snorm
+    UscaledTable,   // NumericSupportFlags::Uscaled
+    SscaledTable,   // NumericSupportFlags::Sscaled
+    UintTable,      // NumericSupportFlags::Uint
+    SintTable,      // NumericSupportFlags::Sint
+    FloatTable,     // NumericSupportFlags::Float
+    SrgbTable,      // NumericSupportFlags::Srgb
+    nullptr,        // NumericSupportFlags::DepthStencil
+    nullptr,        // NumericSupportFlags::Yuv
 };
 
+static_assert(ArrayLen(NumFmtConversionTables) == static_cast<size_t>(NumericSupportFlags::Yuv) + 1,
+              "NumFmtConversionTables does not match the number of NumericSupportFlags!");
+
 // =====================================================================================================================
-// Converts format into its Srgb equivalent.
-ChNumFormat PAL_STDCALL ConvertToSrgb(
-    ChNumFormat format)
+// Checks that every format a conversion table produces actually has the requested numeric format and the same number
+// of bits per pixel as the format it was converted from.
+constexpr bool IsValidConversionTable(
+    const ChNumFormat*  pTable,
+    NumericSupportFlags numericSupport)
 {
-    constexpr ChNumFormat SrgbTable[] =
+    bool isValid = true;
+
+    for (size_t srcIdx = 0; srcIdx < static_cast<size_t>(ChNumFormat::Count); srcIdx++)
     {
-        ChNumFormat::Undefined,             // ChNumFormat::Undefined
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::L4A4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X4Y4Z4W4_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y6Z5_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X5Y5Z5W1_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X1Y5Z5W5_Uscaled
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Unorm
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Snorm
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Uscaled
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Sscaled
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Uint
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Sint
-        ChNumFormat::X8_Srgb,               // ChNumFormat::X8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::A8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::L8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::P8_Unorm
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Unorm
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Snorm
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Uscaled
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Sscaled
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Uint
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Sint
-        ChNumFormat::X8Y8_Srgb,             // ChNumFormat::X8Y8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::L8A8_Unorm
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Unorm
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Snorm
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Uscaled
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Sscaled
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Uint
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Sint
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::X8Y8Z8W8_Srgb
-        ChNumFormat::X8Y8Z8W8_Srgb,         // ChNumFormat::U8V8_Snorm_L8W8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y11Z11_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X11Y11Z10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2Bias_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::U10V10W10_Snorm_A2_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::L16_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Sscaled
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16Z16W16_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Sint
-        ChNumFormat::Undefined,             // ChNumFormat::X32Y32Z32W32_Float
-        ChNumFormat::Undefined,             // ChNumFormat::D16_Unorm_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::D32_Float_S8_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X9Y9Z9E5_Float
-        ChNumFormat::Bc1_Srgb,              // ChNumFormat::Bc1_Unorm
-        ChNumFormat::Bc1_Srgb,              // ChNumFormat::Bc1_Srgb
-        ChNumFormat::Bc2_Srgb,              // ChNumFormat::Bc2_Unorm
-        ChNumFormat::Bc2_Srgb,              // ChNumFormat::Bc2_Srgb
-        ChNumFormat::Bc3_Srgb,              // ChNumFormat::Bc3_Unorm
-        ChNumFormat::Bc3_Srgb,              // ChNumFormat::Bc3_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc4_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc5_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Ufloat
-        ChNumFormat::Undefined,             // ChNumFormat::Bc6_Sfloat
-        ChNumFormat::Bc7_Srgb,              // ChNumFormat::Bc7_Unorm
-        ChNumFormat::Bc7_Srgb,              // ChNumFormat::Bc7_Srgb
-        ChNumFormat::Etc2X8Y8Z8_Srgb,       // ChNumFormat::Etc2X8Y8Z8_Unorm
-        ChNumFormat::Etc2X8Y8Z8_Srgb,       // ChNumFormat::Etc2X8Y8Z8_Srgb
-        ChNumFormat::Etc2X8Y8Z8W1_Srgb,     // ChNumFormat::Etc2X8Y8Z8W1_Unorm
-        ChNumFormat::Etc2X8Y8Z8W1_Srgb,     // ChNumFormat::Etc2X8Y8Z8W1_Srgb
-        ChNumFormat::Etc2X8Y8Z8W8_Srgb,     // ChNumFormat::Etc2X8Y8Z8W8_Unorm
-        ChNumFormat::Etc2X8Y8Z8W8_Srgb,     // ChNumFormat::Etc2X8Y8Z8W8_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11_Snorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Etc2X11Y11_Snorm
-        ChNumFormat::AstcLdr4x4_Srgb,       // ChNumFormat::AstcLdr4x4_Unorm
-        ChNumFormat::AstcLdr4x4_Srgb,       // ChNumFormat::AstcLdr4x4_Srgb
-        ChNumFormat::AstcLdr5x4_Srgb,       // ChNumFormat::AstcLdr5x4_Unorm
-        ChNumFormat::AstcLdr5x4_Srgb,       // ChNumFormat::AstcLdr5x4_Srgb
-        ChNumFormat::AstcLdr5x5_Srgb,       // ChNumFormat::AstcLdr5x5_Unorm
-        ChNumFormat::AstcLdr5x5_Srgb,       // ChNumFormat::AstcLdr5x5_Srgb
-        ChNumFormat::AstcLdr6x5_Srgb,       // ChNumFormat::AstcLdr6x5_Unorm
-        ChNumFormat::AstcLdr6x5_Srgb,       // ChNumFormat::AstcLdr6x5_Srgb
-        ChNumFormat::AstcLdr6x6_Srgb,       // ChNumFormat::AstcLdr6x6_Unorm
-        ChNumFormat::AstcLdr6x6_Srgb,       // ChNumFormat::AstcLdr6x6_Srgb
-        ChNumFormat::AstcLdr8x5_Srgb,       // ChNumFormat::AstcLdr8x5_Unorm
-        ChNumFormat::AstcLdr8x5_Srgb,       // ChNumFormat::AstcLdr8x5_Srgb
-        ChNumFormat::AstcLdr8x6_Srgb,       // ChNumFormat::AstcLdr8x6_Unorm
-        ChNumFormat::AstcLdr8x6_Srgb,       // ChNumFormat::AstcLdr8x6_Srgb
-        ChNumFormat::AstcLdr8x8_Srgb,       // ChNumFormat::AstcLdr8x8_Unorm
-        ChNumFormat::AstcLdr8x8_Srgb,       // ChNumFormat::AstcLdr8x8_Srgb
-        ChNumFormat::AstcLdr10x5_Srgb,      // ChNumFormat::AstcLdr10x5_Unorm
-        ChNumFormat::AstcLdr10x5_Srgb,      // ChNumFormat::AstcLdr10x5_Srgb
-        ChNumFormat::AstcLdr10x6_Srgb,      // ChNumFormat::AstcLdr10x6_Unorm
-        ChNumFormat::AstcLdr10x6_Srgb,      // ChNumFormat::AstcLdr10x6_Srgb
-        ChNumFormat::AstcLdr10x8_Srgb,      // ChNumFormat::AstcLdr10x8_Unorm
-        ChNumFormat::AstcLdr10x8_Srgb,      // ChNumFormat::AstcLdr10x8_Srgb
-        ChNumFormat::AstcLdr10x10_Srgb,     // ChNumFormat::AstcLdr10x10_Unorm
-        ChNumFormat::AstcLdr10x10_Srgb,     // ChNumFormat::AstcLdr10x10_Srgb
-        ChNumFormat::AstcLdr12x10_Srgb,     // ChNumFormat::AstcLdr12x10_Unorm
-        ChNumFormat::AstcLdr12x10_Srgb,     // ChNumFormat::AstcLdr12x10_Srgb
-        ChNumFormat::AstcLdr12x12_Srgb,     // ChNumFormat::AstcLdr12x12_Unorm
-        ChNumFormat::AstcLdr12x12_Srgb,     // ChNumFormat::AstcLdr12x12_Srgb
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr4x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x4_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr5x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr6x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr8x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x5_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x6_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x8_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr10x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x10_Float
-        ChNumFormat::Undefined,             // ChNumFormat::AstcHdr12x12_Float
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_Z8Y8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::Y8X8_Y8Z8_Uscaled
-        ChNumFormat::Undefined,             // ChNumFormat::AYUV
-        ChNumFormat::Undefined,             // ChNumFormat::UYVY
-        ChNumFormat::Undefined,             // ChNumFormat::VYUY
-        ChNumFormat::Undefined,             // ChNumFormat::YUY2
-        ChNumFormat::Undefined,             // ChNumFormat::YVY2
-        ChNumFormat::Undefined,             // ChNumFormat::YV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV11
-        ChNumFormat::Undefined,             // ChNumFormat::NV12
-        ChNumFormat::Undefined,             // ChNumFormat::NV21
-        ChNumFormat::Undefined,             // ChNumFormat::P016
-        ChNumFormat::Undefined,             // ChNumFormat::P010
-        ChNumFormat::Undefined,             // ChNumFormat::P210
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X8Y8_MM_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM10_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P208
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Unorm
-        ChNumFormat::Undefined,             // ChNumFormat::X16Y16_MM12_Uint
-        ChNumFormat::Undefined,             // ChNumFormat::P012
-        ChNumFormat::Undefined,             // ChNumFormat::P212
-        ChNumFormat::Undefined,             // ChNumFormat::P412
-        ChNumFormat::Undefined,             // ChNumFormat::X10Y10Z10W2_Float
-        ChNumFormat::Undefined,             // ChNumFormat::Y216
-        ChNumFormat::Undefined,             // ChNumFormat::Y210
-        ChNumFormat::Undefined,             // ChNumFormat::Y416
-        ChNumFormat::Undefined,             // ChNumFormat::Y410
-        ChNumFormat::Undefined,             // ChNumFormat::_ReservedBE
+        const size_t dstIdx = static_cast<size_t>(pTable[srcIdx]);
+
+        if (pTable[srcIdx] != ChNumFormat::Undefined)
+        {
+            isValid &= (FormatInfoTable[dstIdx].numericSupport == numericSupport) &&
+                       (FormatInfoTable[dstIdx].bitsPerPixel   == FormatInfoTable[srcIdx].bitsPerPixel);
+        }
+    }
+
+    return isValid;
+}
+
+static_assert(IsValidConversionTable(UnormTable, NumericSupportFlags::Unorm),
+              "UnormTable contains a format which is not Unorm or has a different size!");
+static_assert(IsValidConversionTable(SnormTable, NumericSupportFlags::Snorm),
+              "SnormTable contains a format which is not Snorm or has a different size!");
+static_assert(IsValidConversionTable(UscaledTable, NumericSupportFlags::Uscaled),
+              "UscaledTable contains a format which is not Uscaled or has a different size!");
+static_assert(IsValidConversionTable(SscaledTable, NumericSupportFlags::Sscaled),
+              "SscaledTable contains a format which is not Sscaled or has a different size!");
+static_assert(IsValidConversionTable(UintTable, NumericSupportFlags::Uint),
+              "UintTable contains a format which is not Uint or has a different size!");
+static_assert(IsValidConversionTable(SintTable, NumericSupportFlags::Sint),
+              "SintTable contains a format which is not Sint or has a different size!");
+static_assert(IsValidConversionTable(FloatTable, NumericSupportFlags::Float),
+              "FloatTable contains a format which is not Float or has a different size!");
+static_assert(IsValidConversionTable(SrgbTable, NumericSupportFlags::Srgb),
+              "SrgbTable contains a format which is not Srgb or has a different size!");
+
+// Groups of formats which share the same channel format, used by ShareChFmt().
+enum class ChFmtGroup : uint8
+{
+    None,   // The format doesn't share its channel format with any format, not even itself.
+    Unique, // The format only shares its channel format with itself.
+    X1,
+    X4Y4,
+    X4Y4Z4W4,
+    X5Y6Z5,
+    X5Y5Z5W1,
+    X1Y5Z5W5,
+    X8,
+    X8Y8,
+    X8Y8Z8W8,
+    X10Y10Z10W2,
+    X16,
+    X16Y16,
+    X16Y16Z16W16,
+    X32,
+    X32Y32,
+    X32Y32Z32,
+    X32Y32Z32W32,
+    Bc1,
+    Bc2,
+    Bc3,
+    Bc4,
+    Bc5,
+    Bc6,
+    Bc7,
+    Etc2X8Y8Z8,
+    Etc2X8Y8Z8W1,
+    Etc2X8Y8Z8W8,
+    Etc2X11,
+    Etc2X11Y11,
+    AstcLdr4x4,
+    AstcLdr5x4,
+    AstcLdr5x5,
+    AstcLdr6x5,
+    AstcLdr6x6,
+    AstcLdr8x5,
+    AstcLdr8x6,
+    AstcLdr8x8,
+    AstcLdr10x5,
+    AstcLdr10x6,
+    AstcLdr10x8,
+    AstcLdr10x10,
+    AstcLdr12x10,
+    AstcLdr12x12,
+    X8Y8_Z8Y8,
+    Y8X8_Y8Z8,
+};
+
+constexpr ChFmtGroup ChFmtGroupTable[] =
+{
+    ChFmtGroup::Unique,          // ChNumFormat::Undefined
+    ChFmtGroup::X1,              // ChNumFormat::X1_Unorm
+    ChFmtGroup::X1,              // ChNumFormat::X1_Uscaled
+    ChFmtGroup::X4Y4,            // ChNumFormat::X4Y4_Unorm
+    ChFmtGroup::X4Y4,            // ChNumFormat::X4Y4_Uscaled
+    ChFmtGroup::Unique,          // ChNumFormat::L4A4_Unorm
+    ChFmtGroup::X4Y4Z4W4,        // ChNumFormat::X4Y4Z4W4_Unorm
+    ChFmtGroup::X4Y4Z4W4,        // ChNumFormat::X4Y4Z4W4_Uscaled
+    ChFmtGroup::X5Y6Z5,          // ChNumFormat::X5Y6Z5_Unorm
+    ChFmtGroup::X5Y6Z5,          // ChNumFormat::X5Y6Z5_Uscaled
+    ChFmtGroup::X5Y5Z5W1,        // ChNumFormat::X5Y5Z5W1_Unorm
+    ChFmtGroup::X5Y5Z5W1,        // ChNumFormat::X5Y5Z5W1_Uscaled
+    ChFmtGroup::X1Y5Z5W5,        // ChNumFormat::X1Y5Z5W5_Unorm
+    ChFmtGroup::X1Y5Z5W5,        // ChNumFormat::X1Y5Z5W5_Uscaled
+    ChFmtGroup::X8,              // ChNumFormat::X8_Unorm
+    ChFmtGroup::X8,              // ChNumFormat::X8_Snorm
+    ChFmtGroup::X8,              // ChNumFormat::X8_Uscaled
+    ChFmtGroup::X8,              // ChNumFormat::X8_Sscaled
+    ChFmtGroup::X8,              // ChNumFormat::X8_Uint
+    ChFmtGroup::X8,              // ChNumFormat::X8_Sint
+    ChFmtGroup::X8,              // ChNumFormat::X8_Srgb
+    ChFmtGroup::Unique,          // ChNumFormat::A8_Unorm
+    ChFmtGroup::Unique,          // ChNumFormat::L8_Unorm
+    ChFmtGroup::Unique,          // ChNumFormat::P8_Unorm
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Unorm
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Snorm
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Uscaled
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Sscaled
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Uint
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Sint
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_Srgb
+    ChFmtGroup::Unique,          // ChNumFormat::L8A8_Unorm
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Unorm
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Snorm
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Uscaled
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Sscaled
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Uint
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Sint
+    ChFmtGroup::X8Y8Z8W8,        // ChNumFormat::X8Y8Z8W8_Srgb
+    ChFmtGroup::Unique,          // ChNumFormat::U8V8_Snorm_L8W8_Unorm
+    ChFmtGroup::Unique,          // ChNumFormat::X10Y11Z11_Float
+    ChFmtGroup::Unique,          // ChNumFormat::X11Y11Z10_Float
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Unorm
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Snorm
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Uscaled
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Sscaled
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Uint
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Sint
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2Bias_Unorm
+    ChFmtGroup::Unique,          // ChNumFormat::U10V10W10_Snorm_A2_Unorm
+    ChFmtGroup::X16,             // ChNumFormat::X16_Unorm
+    ChFmtGroup::X16,             // ChNumFormat::X16_Snorm
+    ChFmtGroup::X16,             // ChNumFormat::X16_Uscaled
+    ChFmtGroup::X16,             // ChNumFormat::X16_Sscaled
+    ChFmtGroup::X16,             // ChNumFormat::X16_Uint
+    ChFmtGroup::X16,             // ChNumFormat::X16_Sint
+    ChFmtGroup::X16,             // ChNumFormat::X16_Float
+    ChFmtGroup::Unique,          // ChNumFormat::L16_Unorm
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Unorm
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Snorm
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Uscaled
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Sscaled
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Uint
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Sint
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_Float
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Unorm
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Snorm
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Uscaled
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Sscaled
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Uint
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Sint
+    ChFmtGroup::X16Y16Z16W16,    // ChNumFormat::X16Y16Z16W16_Float
+    ChFmtGroup::X32,             // ChNumFormat::X32_Uint
+    ChFmtGroup::X32,             // ChNumFormat::X32_Sint
+    ChFmtGroup::X32,             // ChNumFormat::X32_Float
+    ChFmtGroup::X32Y32,          // ChNumFormat::X32Y32_Uint
+    ChFmtGroup::X32Y32,          // ChNumFormat::X32Y32_Sint
+    ChFmtGroup::X32Y32,          // ChNumFormat::X32Y32_Float
+    ChFmtGroup::X32Y32Z32,       // ChNumFormat::X32Y32Z32_Uint
+    ChFmtGroup::X32Y32Z32,       // ChNumFormat::X32Y32Z32_Sint
+    ChFmtGroup::X32Y32Z32,       // ChNumFormat::X32Y32Z32_Float
+    ChFmtGroup::X32Y32Z32W32,    // ChNumFormat::X32Y32Z32W32_Uint
+    ChFmtGroup::X32Y32Z32W32,    // ChNumFormat::X32Y32Z32W32_Sint
+    ChFmtGroup::X32Y32Z32W32,    // ChNumFormat::X32Y32Z32W32_Float
+    ChFmtGroup::Unique,          // ChNumFormat::D16_Unorm_S8_Uint
+    ChFmtGroup::Unique,          // ChNumFormat::D32_Float_S8_Uint
+    ChFmtGroup::Unique,          // ChNumFormat::X9Y9Z9E5_Float
+    ChFmtGroup::Bc1,             // ChNumFormat::Bc1_Unorm
+    ChFmtGroup::Bc1,             // ChNumFormat::Bc1_Srgb
+    ChFmtGroup::Bc2,             // ChNumFormat::Bc2_Unorm
+    ChFmtGroup::Bc2,             // ChNumFormat::Bc2_Srgb
+    ChFmtGroup::Bc3,             // ChNumFormat::Bc3_Unorm
+    ChFmtGroup::Bc3,             // ChNumFormat::Bc3_Srgb
+    ChFmtGroup::Bc4,             // ChNumFormat::Bc4_Unorm
+    ChFmtGroup::Bc4,             // ChNumFormat::Bc4_Snorm
+    ChFmtGroup::Bc5,             // ChNumFormat::Bc5_Unorm
+    ChFmtGroup::Bc5,             // ChNumFormat::Bc5_Snorm
+    ChFmtGroup::Bc6,             // ChNumFormat::Bc6_Ufloat
+    ChFmtGroup::Bc6,             // ChNumFormat::Bc6_Sfloat
+    ChFmtGroup::Bc7,             // ChNumFormat::Bc7_Unorm
+    ChFmtGroup::Bc7,             // ChNumFormat::Bc7_Srgb
+    ChFmtGroup::Etc2X8Y8Z8,      // ChNumFormat::Etc2X8Y8Z8_Unorm
+    ChFmtGroup::Etc2X8Y8Z8,      // ChNumFormat::Etc2X8Y8Z8_Srgb
+    ChFmtGroup::Etc2X8Y8Z8W1,    // ChNumFormat::Etc2X8Y8Z8W1_Unorm
+    ChFmtGroup::Etc2X8Y8Z8W1,    // ChNumFormat::Etc2X8Y8Z8W1_Srgb
+    ChFmtGroup::Etc2X8Y8Z8W8,    // ChNumFormat::Etc2X8Y8Z8W8_Unorm
+    ChFmtGroup::Etc2X8Y8Z8W8,    // ChNumFormat::Etc2X8Y8Z8W8_Srgb
+    ChFmtGroup::Etc2X11,         // ChNumFormat::Etc2X11_Unorm
+    ChFmtGroup::Etc2X11,         // ChNumFormat::Etc2X11_Snorm
+    ChFmtGroup::Etc2X11Y11,      // ChNumFormat::Etc2X11Y11_Unorm
+    ChFmtGroup::Etc2X11Y11,      // ChNumFormat::Etc2X11Y11_Snorm
+    ChFmtGroup::AstcLdr4x4,      // ChNumFormat::AstcLdr4x4_Unorm
+    ChFmtGroup::AstcLdr4x4,      // ChNumFormat::AstcLdr4x4_Srgb
+    ChFmtGroup::AstcLdr5x4,      // ChNumFormat::AstcLdr5x4_Unorm
+    ChFmtGroup::AstcLdr5x4,      // ChNumFormat::AstcLdr5x4_Srgb
+    ChFmtGroup::AstcLdr5x5,      // ChNumFormat::AstcLdr5x5_Unorm
+    ChFmtGroup::AstcLdr5x5,      // ChNumFormat::AstcLdr5x5_Srgb
+    ChFmtGroup::AstcLdr6x5,      // ChNumFormat::AstcLdr6x5_Unorm
+    ChFmtGroup::AstcLdr6x5,      // ChNumFormat::AstcLdr6x5_Srgb
+    ChFmtGroup::AstcLdr6x6,      // ChNumFormat::AstcLdr6x6_Unorm
+    ChFmtGroup::AstcLdr6x6,      // ChNumFormat::AstcLdr6x6_Srgb
+    ChFmtGroup::AstcLdr8x5,      // ChNumFormat::AstcLdr8x5_Unorm
+    ChFmtGroup::AstcLdr8x5,      // ChNumFormat::AstcLdr8x5_Srgb
+    ChFmtGroup::AstcLdr8x6,      // ChNumFormat::AstcLdr8x6_Unorm
+    ChFmtGroup::AstcLdr8x6,      // ChNumFormat::AstcLdr8x6_Srgb
+    ChFmtGroup::AstcLdr8x8,      // ChNumFormat::AstcLdr8x8_Unorm
+    ChFmtGroup::AstcLdr8x8,      // ChNumFormat::AstcLdr8x8_Srgb
+    ChFmtGroup::AstcLdr10x5,     // ChNumFormat::AstcLdr10x5_Unorm
+    ChFmtGroup::AstcLdr10x5,     // ChNumFormat::AstcLdr10x5_Srgb
+    ChFmtGroup::AstcLdr10x6,     // ChNumFormat::AstcLdr10x6_Unorm
+    ChFmtGroup::AstcLdr10x6,     // ChNumFormat::AstcLdr10x6_Srgb
+    ChFmtGroup::AstcLdr10x8,     // ChNumFormat::AstcLdr10x8_Unorm
+    ChFmtGroup::AstcLdr10x8,     // ChNumFormat::AstcLdr10x8_Srgb
+    ChFmtGroup::AstcLdr10x10,    // ChNumFormat::AstcLdr10x10_Unorm
+    ChFmtGroup::AstcLdr10x10,    // ChNumFormat::AstcLdr10x10_Srgb
+    ChFmtGroup::AstcLdr12x10,    // ChNumFormat::AstcLdr12x10_Unorm
+    ChFmtGroup::AstcLdr12x10,    // ChNumFormat::AstcLdr12x10_Srgb
+    ChFmtGroup::AstcLdr12x12,    // ChNumFormat::AstcLdr12x12_Unorm
+    ChFmtGroup::AstcLdr12x12,    // ChNumFormat::AstcLdr12x12_Srgb
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr4x4_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr5x4_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr5x5_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr6x5_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr6x6_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr8x5_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr8x6_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr8x8_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr10x5_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr10x6_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr10x8_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr10x10_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr12x10_Float
+    ChFmtGroup::Unique,          // ChNumFormat::AstcHdr12x12_Float
+    ChFmtGroup::X8Y8_Z8Y8,       // ChNumFormat::X8Y8_Z8Y8_Unorm
+    ChFmtGroup::X8Y8_Z8Y8,       // ChNumFormat::X8Y8_Z8Y8_Uscaled
+    ChFmtGroup::Y8X8_Y8Z8,       // ChNumFormat::Y8X8_Y8Z8_Unorm
+    ChFmtGroup::Y8X8_Y8Z8,       // ChNumFormat::Y8X8_Y8Z8_Uscaled
+    ChFmtGroup::Unique,          // ChNumFormat::AYUV
+    ChFmtGroup::Unique,          // ChNumFormat::UYVY
+    ChFmtGroup::Unique,          // ChNumFormat::VYUY
+    ChFmtGroup::Unique,          // ChNumFormat::YUY2
+    ChFmtGroup::Unique,          // ChNumFormat::YVY2
+    ChFmtGroup::Unique,          // ChNumFormat::YV12
+    ChFmtGroup::Unique,          // ChNumFormat::NV11
+    ChFmtGroup::Unique,          // ChNumFormat::NV12
+    ChFmtGroup::Unique,          // ChNumFormat::NV21
+    ChFmtGroup::Unique,          // ChNumFormat::P016
+    ChFmtGroup::Unique,          // ChNumFormat::P010
+    ChFmtGroup::Unique,          // ChNumFormat::P210
+    ChFmtGroup::X8,              // ChNumFormat::X8_MM_Unorm
+    ChFmtGroup::X8,              // ChNumFormat::X8_MM_Uint
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_MM_Unorm
+    ChFmtGroup::X8Y8,            // ChNumFormat::X8Y8_MM_Uint
+    ChFmtGroup::X16,             // ChNumFormat::X16_MM10_Unorm
+    ChFmtGroup::X16,             // ChNumFormat::X16_MM10_Uint
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_MM10_Unorm
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_MM10_Uint
+    ChFmtGroup::Unique,          // ChNumFormat::P208
+    ChFmtGroup::X16,             // ChNumFormat::X16_MM12_Unorm
+    ChFmtGroup::X16,             // ChNumFormat::X16_MM12_Uint
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_MM12_Unorm
+    ChFmtGroup::X16Y16,          // ChNumFormat::X16Y16_MM12_Uint
+    ChFmtGroup::Unique,          // ChNumFormat::P012
+    ChFmtGroup::Unique,          // ChNumFormat::P212
+    ChFmtGroup::Unique,          // ChNumFormat::P412
+    ChFmtGroup::X10Y10Z10W2,     // ChNumFormat::X10Y10Z10W2_Float
+    ChFmtGroup::Unique,          // ChNumFormat::Y216
+    ChFmtGroup::Unique,          // ChNumFormat::Y210
+    ChFmtGroup::Unique,          // ChNumFormat::Y416
+    ChFmtGroup::Unique,          // ChNumFormat::Y410
+    ChFmtGroup::None,            // ChNumFormat::_ReservedBE
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-        ChNumFormat::Undefined,             // ChNumFormat::P216
+    ChFmtGroup::Unique,          // ChNumFormat::P216
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P10
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P12
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_420P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_422P16
-        ChNumFormat::Undefined,             // ChNumFormat::YUV_444P16
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_420P10
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_422P10
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_444P10
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_420P12
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_422P12
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_444P12
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_420P16
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_422P16
+    ChFmtGroup::Unique,          // ChNumFormat::YUV_444P16
 #endif
 #if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-        ChNumFormat::Undefined,             // ChNumFormat::YV16
-        ChNumFormat::Undefined,             // ChNumFormat::YV24
-        ChNumFormat::Undefined,             // ChNumFormat::NV24
-        ChNumFormat::Undefined,             // ChNumFormat::P410
-        ChNumFormat::Undefined,             // ChNumFormat::P416
+    ChFmtGroup::Unique,          // ChNumFormat::YV16
+    ChFmtGroup::Unique,          // ChNumFormat::YV24
+    ChFmtGroup::Unique,          // ChNumFormat::NV24
+    ChFmtGroup::Unique,          // ChNumFormat::P410
+    ChFmtGroup::Unique,          // ChNumFormat::P416
 #endif
-    };
+};
+
+static_assert(ArrayLen(ChFmtGroupTable) == static_cast<size_t>(ChNumFormat::Count),
+              "ChFmtGroupTable does not match the number of ChNumFormats!");
+
+// =====================================================================================================================
+// Checks that all formats within a channel format group have the same number of bits per pixel.
+constexpr bool IsValidChFmtGroupTable()
+{
+    bool isValid = true;
+
+    for (size_t fmtIdx = 0; fmtIdx < static_cast<size_t>(ChNumFormat::Count); fmtIdx++)
+    {
+        for (size_t otherIdx = fmtIdx + 1; otherIdx < static_cast<size_t>(ChNumFormat::Count); otherIdx++)
+        {
+            if ((ChFmtGroupTable[fmtIdx] > ChFmtGroup::Unique) &&
+                (ChFmtGroupTable[fmtIdx] == ChFmtGroupTable[otherIdx]))
+            {
+                isValid &= (FormatInfoTable[fmtIdx].bitsPerPixel == FormatInfoTable[otherIdx].bitsPerPixel);
+            }
+        }
+    }
+
+    return isValid;
+}
+
+static_assert(IsValidChFmtGroupTable(), "ChFmtGroupTable groups formats with different sizes!");
+
+// =====================================================================================================================
+// Converts format into its Unorm equivalent.
+ChNumFormat PAL_STDCALL ConvertToUnorm(
+    ChNumFormat format)
+{
+    return UnormTable[static_cast<size_t>(format)];
+}
 
-    static_assert(ArrayLen(SrgbTable) == static_cast<size_t>(ChNumFormat::Count),
-                  "SrgbTable does not match the number of ChNumFormats!");
+// =====================================================================================================================
+// Converts format into its Snorm equivalent.
+ChNumFormat PAL_STDCALL ConvertToSnorm(
+    ChNumFormat format)
+{
+    return SnormTable[static_cast<size_t>(format)];
+}
+
+// =====================================================================================================================
+// Converts format into its Uscaled equivalent.
+ChNumFormat PAL_STDCALL ConvertToUscaled(
+    ChNumFormat format)
+{
+    return UscaledTable[static_cast<size_t>(format)];
+}
+
+// =====================================================================================================================
+// Converts format into its Sscaled equivalent.
+ChNumFormat PAL_STDCALL ConvertToSscaled(
+    ChNumFormat format)
+{
+    return SscaledTable[static_cast<size_t>(format)];
+}
+
+// =====================================================================================================================
+// Converts format into its Uint equivalent.
+ChNumFormat PAL_STDCALL ConvertToUint(
+    ChNumFormat format)
+{
+    return UintTable[static_cast<size_t>(format)];
+}
 
+// =====================================================================================================================
+// Converts format into its Sint equivalent.
+ChNumFormat PAL_STDCALL ConvertToSint(
+    ChNumFormat format)
+{
+    return SintTable[static_cast<size_t>(format)];
+}
+
+// =====================================================================================================================
+// Converts format into its Float equivalent.
+ChNumFormat PAL_STDCALL ConvertToFloat(
+    ChNumFormat format)
+{
+    return FloatTable[static_cast<size_t>(format)];
+}
+
+// =====================================================================================================================
+// Converts format into its Srgb equivalent.
+ChNumFormat PAL_STDCALL ConvertToSrgb(
+    ChNumFormat format)
+{
     return SrgbTable[static_cast<size_t>(format)];
-};
+}
 
 // =====================================================================================================================
 // Converts source numeric format to the provided destination numeric format.
@@ -2288,44 +2638,12 @@ ChNumFormat ConvertToDstNumFmt(
     ChNumFormat srcFormat,
     ChNumFormat dstFormat)
 {
-    ChNumFormat format = ChNumFormat::Undefined;
+    const NumericSupportFlags numericSupport = FormatInfoTable[static_cast<size_t>(dstFormat)].numericSupport;
+    const ChNumFormat*        pTable         = NumFmtConversionTables[static_cast<size_t>(numericSupport)];
 
-    switch (FormatInfoTable[static_cast<size_t>(dstFormat)].numericSupport)
-    {
-    case NumericSupportFlags::Unorm:
-        format = ConvertToUnorm(srcFormat);
-        break;
-    case NumericSupportFlags::Snorm:
-        format = ConvertToSnorm(srcFormat);
-        break;
-    case NumericSupportFlags::Uscaled:
-        format = ConvertToUscaled(srcFormat);
-        break;
-    case NumericSupportFlags::Sscaled:
-        format = ConvertToSscaled(srcFormat);
-        break;
-    case NumericSupportFlags::Uint:
-        format = ConvertToUint(srcFormat);
-        break;
-    case NumericSupportFlags::Sint:
-        format = ConvertToSint(srcFormat);
-        break;
-    case NumericSupportFlags::Float:
-        format = ConvertToFloat(srcFormat);
-        break;
-    case NumericSupportFlags::Srgb:
-        format = ConvertToSrgb(srcFormat);
-        break;
-    case NumericSupportFlags::DepthStencil:
-    case NumericSupportFlags::Yuv:
-    case NumericSupportFlags::Undefined:
-    default:
-        PAL_ASSERT(srcFormat == dstFormat);
-        format = srcFormat;
-        break;
-    }
+    PAL_ASSERT((pTable != nullptr) || (srcFormat == dstFormat));
 
-    return format;
+    return (pTable != nullptr) ? pTable[static_cast<size_t>(srcFormat)] : srcFormat;
 }
 
 // =====================================================================================================================
@@ -2336,356 +2654,13 @@ bool ShareChFmt(
 {
     bool isSame = false;
 
-    switch (srcFormat)
+    if ((srcFormat < ChNumFormat::Count) && (dstFormat < ChNumFormat::Count))
     {
-    case ChNumFormat::Undefined:
-    case ChNumFormat::L4A4_Unorm:
-    case ChNumFormat::A8_Unorm:
-    case ChNumFormat::L8_Unorm:
-    case ChNumFormat::P8_Unorm:
-    case ChNumFormat::L8A8_Unorm:
-    case ChNumFormat::X10Y11Z11_Float:
-    case ChNumFormat::X11Y11Z10_Float:
-    case ChNumFormat::L16_Unorm:
-    case ChNumFormat::D16_Unorm_S8_Uint:
-    case ChNumFormat::D32_Float_S8_Uint:
-    case ChNumFormat::X9Y9Z9E5_Float:
-    case ChNumFormat::AstcHdr4x4_Float:
-    case ChNumFormat::AstcHdr5x4_Float:
-    case ChNumFormat::AstcHdr5x5_Float:
-    case ChNumFormat::AstcHdr6x5_Float:
-    case ChNumFormat::AstcHdr6x6_Float:
-    case ChNumFormat::AstcHdr8x5_Float:
-    case ChNumFormat::AstcHdr8x6_Float:
-    case ChNumFormat::AstcHdr8x8_Float:
-    case ChNumFormat::AstcHdr10x5_Float:
-    case ChNumFormat::AstcHdr10x6_Float:
-    case ChNumFormat::AstcHdr10x8_Float:
-    case ChNumFormat::AstcHdr10x10_Float:
-    case ChNumFormat::AstcHdr12x10_Float:
-    case ChNumFormat::AstcHdr12x12_Float:
-    case ChNumFormat::AYUV:
-    case ChNumFormat::UYVY:
-    case ChNumFormat::VYUY:
-    case ChNumFormat::YUY2:
-    case ChNumFormat::YVY2:
-    case ChNumFormat::YV12:
-    case ChNumFormat::NV11:
-    case ChNumFormat::NV12:
-    case ChNumFormat::NV21:
-    case ChNumFormat::P016:
-    case ChNumFormat::P010:
-    case ChNumFormat::P208:
-    case ChNumFormat::P210:
-    case ChNumFormat::P012:
-    case ChNumFormat::P212:
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 923
-    case ChNumFormat::P216:
-#endif
-    case ChNumFormat::P412:
-    case ChNumFormat::U8V8_Snorm_L8W8_Unorm:
-    case ChNumFormat::U10V10W10_Snorm_A2_Unorm:
-    case ChNumFormat::Y216:
-    case ChNumFormat::Y210:
-    case ChNumFormat::Y416:
-    case ChNumFormat::Y410:
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 924
-    case ChNumFormat::YUV_420P10:
-    case ChNumFormat::YUV_422P10:
-    case ChNumFormat::YUV_444P10:
-    case ChNumFormat::YUV_420P12:
-    case ChNumFormat::YUV_422P12:
-    case ChNumFormat::YUV_444P12:
-    case ChNumFormat::YUV_420P16:
-    case ChNumFormat::YUV_422P16:
-    case ChNumFormat::YUV_444P16:
-#endif
-#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 925
-    case ChNumFormat::YV16:
-    case ChNumFormat::YV24:
-    case ChNumFormat::NV24:
-    case ChNumFormat::P410:
-    case ChNumFormat::P416:
-#endif
-        isSame = (srcFormat == dstFormat);
-        break;
-    case ChNumFormat::X1_Unorm:
-    case ChNumFormat::X1_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X1_Unorm) || (dstFormat == ChNumFormat::X1_Uscaled));
-        break;
-    case ChNumFormat::X4Y4_Unorm:
-    case ChNumFormat::X4Y4_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X4Y4_Unorm) || (dstFormat == ChNumFormat::X4Y4_Uscaled));
-        break;
-    case ChNumFormat::X4Y4Z4W4_Unorm:
-    case ChNumFormat::X4Y4Z4W4_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X4Y4Z4W4_Unorm) || (dstFormat == ChNumFormat::X4Y4Z4W4_Uscaled));
-        break;
-    case ChNumFormat::X5Y6Z5_Unorm:
-    case ChNumFormat::X5Y6Z5_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X5Y6Z5_Unorm) || (dstFormat == ChNumFormat::X5Y6Z5_Uscaled));
-        break;
-    case ChNumFormat::X5Y5Z5W1_Unorm:
-    case ChNumFormat::X5Y5Z5W1_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X5Y5Z5W1_Unorm) || (dstFormat == ChNumFormat::X5Y5Z5W1_Uscaled));
-        break;
-    case ChNumFormat::X1Y5Z5W5_Unorm:
-    case ChNumFormat::X1Y5Z5W5_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X1Y5Z5W5_Unorm) || (dstFormat == ChNumFormat::X1Y5Z5W5_Uscaled));
-        break;
-    case ChNumFormat::X8_Unorm:
-    case ChNumFormat::X8_Snorm:
-    case ChNumFormat::X8_Uscaled:
-    case ChNumFormat::X8_Sscaled:
-    case ChNumFormat::X8_Uint:
-    case ChNumFormat::X8_Sint:
-    case ChNumFormat::X8_Srgb:
-    case ChNumFormat::X8_MM_Unorm:
-    case ChNumFormat::X8_MM_Uint:
-        isSame = ((dstFormat == ChNumFormat::X8_Unorm)   || (dstFormat == ChNumFormat::X8_Snorm)    ||
-                  (dstFormat == ChNumFormat::X8_Uscaled) || (dstFormat == ChNumFormat::X8_Sscaled)  ||
-                  (dstFormat == ChNumFormat::X8_Uint)    || (dstFormat == ChNumFormat::X8_Sint)     ||
-                  (dstFormat == ChNumFormat::X8_Srgb)    || (dstFormat == ChNumFormat::X8_MM_Unorm) ||
-                  (dstFormat == ChNumFormat::X8_MM_Uint));
-        break;
-    case ChNumFormat::X8Y8_Unorm:
-    case ChNumFormat::X8Y8_Snorm:
-    case ChNumFormat::X8Y8_Uscaled:
-    case ChNumFormat::X8Y8_Sscaled:
-    case ChNumFormat::X8Y8_Uint:
-    case ChNumFormat::X8Y8_Sint:
-    case ChNumFormat::X8Y8_Srgb:
-    case ChNumFormat::X8Y8_MM_Unorm:
-    case ChNumFormat::X8Y8_MM_Uint:
-        isSame = ((dstFormat == ChNumFormat::X8Y8_Unorm)   || (dstFormat == ChNumFormat::X8Y8_Snorm)    ||
-                  (dstFormat == ChNumFormat::X8Y8_Uscaled) || (dstFormat == ChNumFormat::X8Y8_Sscaled)  ||
-                  (dstFormat == ChNumFormat::X8Y8_Uint)    || (dstFormat == ChNumFormat::X8Y8_Sint)     ||
-                  (dstFormat == ChNumFormat::X8Y8_Srgb)    || (dstFormat == ChNumFormat::X8Y8_MM_Unorm) ||
-                  (dstFormat == ChNumFormat::X8Y8_MM_Uint));
-        break;
-    case ChNumFormat::X8Y8Z8W8_Unorm:
-    case ChNumFormat::X8Y8Z8W8_Snorm:
-    case ChNumFormat::X8Y8Z8W8_Uscaled:
-    case ChNumFormat::X8Y8Z8W8_Sscaled:
-    case ChNumFormat::X8Y8Z8W8_Uint:
-    case ChNumFormat::X8Y8Z8W8_Sint:
-    case ChNumFormat::X8Y8Z8W8_Srgb:
-        isSame = ((dstFormat == ChNumFormat::X8Y8Z8W8_Unorm)   || (dstFormat == ChNumFormat::X8Y8Z8W8_Snorm)   ||
-                  (dstFormat == ChNumFormat::X8Y8Z8W8_Uscaled) || (dstFormat == ChNumFormat::X8Y8Z8W8_Sscaled) ||
-                  (dstFormat == ChNumFormat::X8Y8Z8W8_Uint)    || (dstFormat == ChNumFormat::X8Y8Z8W8_Sint)    ||
-                  (dstFormat == ChNumFormat::X8Y8Z8W8_Srgb));
-        break;
-    case ChNumFormat::X10Y10Z10W2_Unorm:
-    case ChNumFormat::X10Y10Z10W2_Snorm:
-    case ChNumFormat::X10Y10Z10W2_Uscaled:
-    case ChNumFormat::X10Y10Z10W2_Sscaled:
-    case ChNumFormat::X10Y10Z10W2_Uint:
-    case ChNumFormat::X10Y10Z10W2_Sint:
-    case ChNumFormat::X10Y10Z10W2_Float:
-    case ChNumFormat::X10Y10Z10W2Bias_Unorm:
-        isSame = ((dstFormat == ChNumFormat::X10Y10Z10W2_Unorm)   ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Snorm)   ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Uscaled) ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Sscaled) ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Uint)    ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Sint)    ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2_Float)   ||
-                  (dstFormat == ChNumFormat::X10Y10Z10W2Bias_Unorm));
-        break;
-    case ChNumFormat::X16_Unorm:
-    case ChNumFormat::X16_Snorm:
-    case ChNumFormat::X16_Uscaled:
-    case ChNumFormat::X16_Sscaled:
-    case ChNumFormat::X16_Uint:
-    case ChNumFormat::X16_Sint:
-    case ChNumFormat::X16_Float:
-    case ChNumFormat::X16_MM10_Unorm:
-    case ChNumFormat::X16_MM10_Uint:
-    case ChNumFormat::X16_MM12_Unorm:
-    case ChNumFormat::X16_MM12_Uint:
-        isSame = ((dstFormat == ChNumFormat::X16_Unorm)     || (dstFormat == ChNumFormat::X16_Snorm)    ||
-                  (dstFormat == ChNumFormat::X16_Uscaled)   || (dstFormat == ChNumFormat::X16_Sscaled)  ||
-                  (dstFormat == ChNumFormat::X16_Uint)      || (dstFormat == ChNumFormat::X16_Sint)     ||
-                  (dstFormat == ChNumFormat::X16_Float)     || (dstFormat == ChNumFormat::X16_MM10_Unorm) ||
-                  (dstFormat == ChNumFormat::X16_MM10_Uint) || (dstFormat == ChNumFormat::X16_MM12_Unorm) ||
-                  (dstFormat == ChNumFormat::X16_MM12_Uint));
-        break;
-    case ChNumFormat::X16Y16_Unorm:
-    case ChNumFormat::X16Y16_Snorm:
-    case ChNumFormat::X16Y16_Uscaled:
-    case ChNumFormat::X16Y16_Sscaled:
-    case ChNumFormat::X16Y16_Uint:
-    case ChNumFormat::X16Y16_Sint:
-    case ChNumFormat::X16Y16_Float:
-    case ChNumFormat::X16Y16_MM10_Unorm:
-    case ChNumFormat::X16Y16_MM10_Uint:
-    case ChNumFormat::X16Y16_MM12_Unorm:
-    case ChNumFormat::X16Y16_MM12_Uint:
-        isSame = ((dstFormat == ChNumFormat::X16Y16_Unorm)     || (dstFormat == ChNumFormat::X16Y16_Snorm)    ||
-                  (dstFormat == ChNumFormat::X16Y16_Uscaled)   || (dstFormat == ChNumFormat::X16Y16_Sscaled)  ||
-                  (dstFormat == ChNumFormat::X16Y16_Uint)      || (dstFormat == ChNumFormat::X16Y16_Sint)     ||
-                  (dstFormat == ChNumFormat::X16Y16_Float)     || (dstFormat == ChNumFormat::X16Y16_MM10_Unorm) ||
-                  (dstFormat == ChNumFormat::X16Y16_MM10_Uint) || (dstFormat == ChNumFormat::X16Y16_MM12_Unorm) ||
-                  (dstFormat == ChNumFormat::X16Y16_MM12_Uint));
-        break;
-    case ChNumFormat::X16Y16Z16W16_Unorm:
-    case ChNumFormat::X16Y16Z16W16_Snorm:
-    case ChNumFormat::X16Y16Z16W16_Uscaled:
-    case ChNumFormat::X16Y16Z16W16_Sscaled:
-    case ChNumFormat::X16Y16Z16W16_Uint:
-    case ChNumFormat::X16Y16Z16W16_Sint:
-    case ChNumFormat::X16Y16Z16W16_Float:
-        isSame = ((dstFormat == ChNumFormat::X16Y16Z16W16_Unorm)   ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Snorm)   ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Uscaled) ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Sscaled) ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Uint)    ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Sint)    ||
-                  (dstFormat == ChNumFormat::X16Y16Z16W16_Float));
-        break;
-    case ChNumFormat::X32_Uint:
-    case ChNumFormat::X32_Sint:
-    case ChNumFormat::X32_Float:
-        isSame = ((dstFormat == ChNumFormat::X32_Uint) ||
-                  (dstFormat == ChNumFormat::X32_Sint) ||
-                  (dstFormat == ChNumFormat::X32_Float));
-        break;
-    case ChNumFormat::X32Y32_Uint:
-    case ChNumFormat::X32Y32_Sint:
-    case ChNumFormat::X32Y32_Float:
-        isSame = ((dstFormat == ChNumFormat::X32Y32_Uint) ||
-                  (dstFormat == ChNumFormat::X32Y32_Sint) ||
-                  (dstFormat == ChNumFormat::X32Y32_Float));
-        break;
-    case ChNumFormat::X32Y32Z32_Uint:
-    case ChNumFormat::X32Y32Z32_Sint:
-    case ChNumFormat::X32Y32Z32_Float:
-        isSame = ((dstFormat == ChNumFormat::X32Y32Z32_Uint) ||
-                  (dstFormat == ChNumFormat::X32Y32Z32_Sint) ||
-                  (dstFormat == ChNumFormat::X32Y32Z32_Float));
-        break;
-    case ChNumFormat::X32Y32Z32W32_Uint:
-    case ChNumFormat::X32Y32Z32W32_Sint:
-    case ChNumFormat::X32Y32Z32W32_Float:
-        isSame = ((dstFormat == ChNumFormat::X32Y32Z32W32_Uint) ||
-                  (dstFormat == ChNumFormat::X32Y32Z32W32_Sint) ||
-                  (dstFormat == ChNumFormat::X32Y32Z32W32_Float));
-        break;
-    case ChNumFormat::Bc1_Unorm:
-    case ChNumFormat::Bc1_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Bc1_Unorm) || (dstFormat == ChNumFormat::Bc1_Srgb));
-        break;
-    case ChNumFormat::Bc2_Unorm:
-    case ChNumFormat::Bc2_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Bc2_Unorm) || (dstFormat == ChNumFormat::Bc2_Srgb));
-        break;
-    case ChNumFormat::Bc3_Unorm:
-    case ChNumFormat::Bc3_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Bc3_Unorm) || (dstFormat == ChNumFormat::Bc3_Srgb));
-        break;
-    case ChNumFormat::Bc4_Unorm:
-    case ChNumFormat::Bc4_Snorm:
-        isSame = ((dstFormat == ChNumFormat::Bc4_Unorm) || (dstFormat == ChNumFormat::Bc4_Snorm));
-        break;
-    case ChNumFormat::Bc5_Unorm:
-    case ChNumFormat::Bc5_Snorm:
-        isSame = ((dstFormat == ChNumFormat::Bc5_Unorm) || (dstFormat == ChNumFormat::Bc5_Snorm));
-        break;
-    case ChNumFormat::Bc6_Ufloat:
-    case ChNumFormat::Bc6_Sfloat:
-        isSame = ((dstFormat == ChNumFormat::Bc6_Ufloat) || (dstFormat == ChNumFormat::Bc6_Sfloat));
-        break;
-    case ChNumFormat::Bc7_Unorm:
-    case ChNumFormat::Bc7_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Bc7_Unorm) || (dstFormat == ChNumFormat::Bc7_Srgb));
-        break;
-    case ChNumFormat::Etc2X8Y8Z8_Unorm:
-    case ChNumFormat::Etc2X8Y8Z8_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Etc2X8Y8Z8_Unorm) || (dstFormat == ChNumFormat::Etc2X8Y8Z8_Srgb));
-        break;
-    case ChNumFormat::Etc2X8Y8Z8W1_Unorm:
-    case ChNumFormat::Etc2X8Y8Z8W1_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Etc2X8Y8Z8W1_Unorm) || (dstFormat == ChNumFormat::Etc2X8Y8Z8W1_Srgb));
-        break;
-    case ChNumFormat::Etc2X8Y8Z8W8_Unorm:
-    case ChNumFormat::Etc2X8Y8Z8W8_Srgb:
-        isSame = ((dstFormat == ChNumFormat::Etc2X8Y8Z8W8_Unorm) || (dstFormat == ChNumFormat::Etc2X8Y8Z8W8_Srgb));
-        break;
-    case ChNumFormat::Etc2X11_Unorm:
-    case ChNumFormat::Etc2X11_Snorm:
-        isSame = ((dstFormat == ChNumFormat::Etc2X11_Unorm) || (dstFormat == ChNumFormat::Etc2X11_Snorm));
-        break;
-    case ChNumFormat::Etc2X11Y11_Unorm:
-    case ChNumFormat::Etc2X11Y11_Snorm:
-        isSame = ((dstFormat == ChNumFormat::Etc2X11Y11_Unorm) || (dstFormat == ChNumFormat::Etc2X11Y11_Snorm));
-        break;
-    case ChNumFormat::AstcLdr4x4_Unorm:
-    case ChNumFormat::AstcLdr4x4_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr4x4_Unorm) || (dstFormat == ChNumFormat::AstcLdr4x4_Srgb));
-        break;
-    case ChNumFormat::AstcLdr5x4_Unorm:
-    case ChNumFormat::AstcLdr5x4_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr5x4_Unorm) || (dstFormat == ChNumFormat::AstcLdr5x4_Srgb));
-        break;
-    case ChNumFormat::AstcLdr5x5_Unorm:
-    case ChNumFormat::AstcLdr5x5_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr5x5_Unorm) || (dstFormat == ChNumFormat::AstcLdr5x5_Srgb));
-        break;
-    case ChNumFormat::AstcLdr6x5_Unorm:
-    case ChNumFormat::AstcLdr6x5_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr6x5_Unorm) || (dstFormat == ChNumFormat::AstcLdr6x5_Srgb));
-        break;
-    case ChNumFormat::AstcLdr6x6_Unorm:
-    case ChNumFormat::AstcLdr6x6_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr6x6_Unorm) || (dstFormat == ChNumFormat::AstcLdr6x6_Srgb));
-        break;
-    case ChNumFormat::AstcLdr8x5_Unorm:
-    case ChNumFormat::AstcLdr8x5_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr8x5_Unorm) || (dstFormat == ChNumFormat::AstcLdr8x5_Srgb));
-        break;
-    case ChNumFormat::AstcLdr8x6_Unorm:
-    case ChNumFormat::AstcLdr8x6_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr8x6_Unorm) || (dstFormat == ChNumFormat::AstcLdr8x6_Srgb));
-        break;
-    case ChNumFormat::AstcLdr8x8_Unorm:
-    case ChNumFormat::AstcLdr8x8_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr8x8_Unorm) || (dstFormat == ChNumFormat::AstcLdr8x8_Srgb));
-        break;
-    case ChNumFormat::AstcLdr10x5_Unorm:
-    case ChNumFormat::AstcLdr10x5_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr10x5_Unorm) || (dstFormat == ChNumFormat::AstcLdr10x5_Srgb));
-        break;
-    case ChNumFormat::AstcLdr10x6_Unorm:
-    case ChNumFormat::AstcLdr10x6_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr10x6_Unorm) || (dstFormat == ChNumFormat::AstcLdr10x6_Srgb));
-        break;
-    case ChNumFormat::AstcLdr10x8_Unorm:
-    case ChNumFormat::AstcLdr10x8_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr10x8_Unorm) || (dstFormat == ChNumFormat::AstcLdr10x8_Srgb));
-        break;
-    case ChNumFormat::AstcLdr10x10_Unorm:
-    case ChNumFormat::AstcLdr10x10_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr10x10_Unorm) || (dstFormat == ChNumFormat::AstcLdr10x10_Srgb));
-        break;
-    case ChNumFormat::AstcLdr12x10_Unorm:
-    case ChNumFormat::AstcLdr12x10_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr12x10_Unorm) || (dstFormat == ChNumFormat::AstcLdr12x10_Srgb));
-        break;
-    case ChNumFormat::AstcLdr12x12_Unorm:
-    case ChNumFormat::AstcLdr12x12_Srgb:
-        isSame = ((dstFormat == ChNumFormat::AstcLdr12x12_Unorm) || (dstFormat == ChNumFormat::AstcLdr12x12_Srgb));
-        break;
-    case ChNumFormat::X8Y8_Z8Y8_Unorm:
-    case ChNumFormat::X8Y8_Z8Y8_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::X8Y8_Z8Y8_Unorm) || (dstFormat == ChNumFormat::X8Y8_Z8Y8_Uscaled));
-        break;
-    case ChNumFormat::Y8X8_Y8Z8_Unorm:
-    case ChNumFormat::Y8X8_Y8Z8_Uscaled:
-        isSame = ((dstFormat == ChNumFormat::Y8X8_Y8Z8_Unorm) || (dstFormat == ChNumFormat::Y8X8_Y8Z8_Uscaled));
-        break;
-    case ChNumFormat::Count:
-        isSame = false;
-        break;
+        const ChFmtGroup group = ChFmtGroupTable[static_cast<size_t>(srcFormat)];
+
+        isSame = (group == ChFmtGroup::Unique) ? (srcFormat == dstFormat)
+                                               : ((group != ChFmtGroup::None) &&
+                                                  (group == ChFmtGroupTable[static_cast<size_t>(dstFormat)]));
     }
 
     return isSame;
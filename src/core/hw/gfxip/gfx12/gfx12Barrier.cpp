@@ -1138,8 +1138,18 @@ void BarrierMgr::IssueReleaseThenAcquireSync(
 {
     const EngineType    engineType    = pCmdBuf->GetEngineType();
     auto* const         pCmdStream    = static_cast<CmdStream*>(pCmdBuf->GetMainCmdStream());
+    const AcquirePoint  origAcqPoint  = GetAcquirePoint(dstStageMask, engineType);
+    const uint64        origCmdPos    = pCmdStream->GetWritePosition();
+
+    if (m_gfxDevice.CoalesceRedundantBarriers() &&
+        IsReleaseThenAcquireSyncRedundant(*pCmdBuf, origCmdPos, srcStageMask, origAcqPoint, cacheOps))
+    {
+        // The previous sync already did everything this one would do and no work has been recorded since.
+        return;
+    }
+
     uint32*             pCmdSpace     = pCmdStream->ReserveCommands();
-    AcquirePoint        acquirePoint  = GetAcquirePoint(dstStageMask, engineType);
+    AcquirePoint        acquirePoint  = origAcqPoint;
     const ReleaseEvents releaseEvents = GetReleaseEvents(srcStageMask, cacheOps, acquirePoint, pBarrierOps);
     SyncGlxFlags        syncGlxFlags  = cacheOps.glxFlags;
     const bool          syncSrcCaches = TestAllFlagsSet(syncGlxFlags, SyncGl2WbInv | SyncGlkInv | SyncGlvInv);
@@ -1376,6 +1386,34 @@ void BarrierMgr::IssueReleaseThenAcquireSync(
     }
 
     pCmdStream->CommitCommands(pCmdSpace);
+
+    // Only remember syncs which actually wrote something and can't be skipped by the CP due to predication.
+    if ((pCmdStream->GetWritePosition() != origCmdPos) && (pCmdBuf->GetPacketPredicate() == 0))
+    {
+        pCmdBuf->SetPrevBarrierSync(srcStageMask, PackCacheSyncOps(cacheOps), uint8(origAcqPoint));
+    }
+}
+
+// =====================================================================================================================
+// Returns true if a release-then-acquire sync with the given parameters is implied by the previous one written into
+// this command buffer. That's only the case if nothing was written to the main command stream since then, and the
+// previous sync released a superset of the stages, acquired at the same or an earlier point and did a superset of
+// the cache operations.
+bool BarrierMgr::IsReleaseThenAcquireSyncRedundant(
+    const GfxCmdBuffer& cmdBuf,
+    uint64              cmdStreamPos,
+    uint32              srcStageMask,
+    AcquirePoint        acquirePoint,
+    CacheSyncOps        cacheOps
+    ) const
+{
+    const auto& prevSync = cmdBuf.GetCmdBufState().prevBarrierSync;
+
+    return prevSync.valid                                          &&
+           (prevSync.cmdStreamPos == cmdStreamPos)                 &&
+           TestAllFlagsSet(prevSync.srcStageMask, srcStageMask)    &&
+           (prevSync.hwAcqPoint <= uint8(acquirePoint))            &&
+           TestAllFlagsSet(prevSync.hwCacheOps, PackCacheSyncOps(cacheOps));
 }
 
 // =====================================================================================================================
@@ -73,6 +73,13 @@ constexpr CacheSyncOps& operator|=(CacheSyncOps& lhs, CacheSyncOps rhs)
     return lhs;
 }
 
+// Packs CacheSyncOps into a bitmask so that it can be stored opaquely in the GfxCmdBuffer and tested for subsets.
+constexpr uint32 PackCacheSyncOps(CacheSyncOps cacheOps)
+{
+    static_assert(sizeof(SyncGlxFlags) == sizeof(uint8));
+    return uint32(cacheOps.glxFlags) | (uint32(cacheOps.rbCache) << 8) | (uint32(cacheOps.timestamp) << 9);
+}
+
 // =====================================================================================================================
 // HWL Barrier Processing Manager: contain layout transition BLT and pre/post-BLT execution and memory dependencies.
 class BarrierMgr final : public GfxBarrierMgr
@@ -222,6 +229,13 @@ private:
 
     AcquirePoint GetAcquirePoint(uint32 dstStageMask, EngineType engineType) const;
 
+    bool IsReleaseThenAcquireSyncRedundant(
+        const GfxCmdBuffer& cmdBuf,
+        uint64              cmdStreamPos,
+        uint32              srcStageMask,
+        AcquirePoint        acquirePoint,
+        CacheSyncOps        cacheOps) const;
+
     const Gfx12::Device& m_gfxDevice;
     const CmdUtil&       m_cmdUtil;
 
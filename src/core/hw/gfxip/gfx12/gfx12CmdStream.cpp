@@ -262,34 +262,7 @@ void CmdStream::Call(
         }
         else if (exclusiveSubmit && (m_chainIbSpaceInDwords != 0) && (gfxStream.m_chainIbSpaceInDwords != 0))
         {
-            // NOTE: To call a command stream which supports chaining and has the exclusive submit optmization enabled,
-            // we only need to jump to the callee's first chunk, and then jump back here when the callee finishes.
-
-            if (IsEmpty())
-            {
-                // The call to EndCommandBlock() below will not succeed if this command stream is currently empty. Add
-                // the smallest-possible NOP packet to prevent the stream from being empty.
-                uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
-                BuildNop(m_minNopSizeInDwords, pNopPacket);
-            }
-
-            // End our current command block, using the jump to the callee's first chunk as our block postamble.
-            const auto*const pJumpChunk   = targetStream.GetFirstChunk();
-            uint32*const     pChainPacket = EndCommandBlock(m_chainIbSpaceInDwords, false);
-            BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
-                                pJumpChunk->CmdDwordsToExecute(),
-                                targetStream.IsPreemptionEnabled(),
-                                true,
-                                pChainPacket);
-
-            // Returning to the call site requires patching the callee's tail-chain with a packet which brings us
-            // back here. However, we need to know the size of the current command block in order to fully construct
-            // a chaining packet. So, the solution is to add a chain patch at the callee's tail-chain location which
-            // will correspond to the current block.
-
-            // NOTE: The callee's End() method was called after it was done being recorded. That call already built
-            // us a dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
-            AddChainPatch(ChainPatchType::IndirectBuffer, gfxStream.m_pTailChainLocation);
+            ChainCall(gfxStream);
         }
         else
         {
@@ -411,6 +411,7 @@ public:
     Result AllocatePosBufferMem(bool isTmz);
 
     bool EnableReleaseMemWaitCpDma() const { return Settings().enableReleaseMemWaitCpDma; }
+    bool CoalesceRedundantBarriers() const { return Settings().coalesceRedundantBarriers; }
 
     uint32 GetShaderPrefetchSize(gpusize shaderSizeBytes) const;
 
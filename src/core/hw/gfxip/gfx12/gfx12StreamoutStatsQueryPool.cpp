@@ -312,9 +312,16 @@ bool StreamoutStatsQueryPool::ComputeResults(
         const Gfx12StreamoutStatsDataPair* pDataPair = static_cast<const Gfx12StreamoutStatsDataPair*>(pGpuData);
         Gfx12StreamoutStatsData* pQueryData          = static_cast<Gfx12StreamoutStatsData*>(pData);
 
-        bool countersReady = false;
+        uint32 attempt       = 0;
+        bool   countersReady = false;
         do
         {
+            if (attempt > 0)
+            {
+                // Give up the CPU between polls rather than spinning on memory the GPU hasn't written yet.
+                QueryPool::WaitForResultsBackoff(attempt - 1);
+            }
+
             countersReady = IsQueryDataValid(&pDataPair->end.primCountWritten)    &&
                             IsQueryDataValid(&pDataPair->begin.primCountWritten)  &&
                             IsQueryDataValid(&pDataPair->end.primStorageNeeded)   &&
@@ -323,6 +330,7 @@ bool StreamoutStatsQueryPool::ComputeResults(
                                pDataPair->begin.primCountWritten &
                                pDataPair->end.primStorageNeeded  &
                                pDataPair->begin.primStorageNeeded) & StreamoutStatsResultValidMask) != 0);
+            attempt++;
         } while ((countersReady == false) && TestAnyFlagSet(flags, QueryResultWait));
 
         if (countersReady)
@@ -588,46 +588,30 @@ uint32* ComputeCmdBuffer::ValidateUserData(
     {
         const uint16 userDataLimit = m_pSignatureCs->userDataLimit;
         PAL_ASSERT(userDataLimit != 0);
-        const uint16 lastUserData = (userDataLimit - 1);
 
         // Step #2:
         // Because the spill table is managed using CPU writes to embedded data, it must be fully re-uploaded for any
         // Dispatch whenever *any* contents have changed.
         bool reUpload = (pSpillTable->dirty != 0);
-        if (HasPipelineChanged &&
-            ((spillThreshold < pPrevSignature->spillThreshold) || (userDataLimit > pPrevSignature->userDataLimit)))
+        if ((spillThreshold < pSpillTable->validFirst) || (userDataLimit > pSpillTable->validLimit))
         {
-            // If the pipeline is changing and the spilled region is expanding, we need to re-upload the table because
-            // we normally only update the portions useable by the bound pipeline to minimize memory usage.
+            // The current copy of the table doesn't hold valid data for the whole spilled region. This happens if the
+            // pipeline is changing and the spilled region is expanding because we normally only update the portions
+            // useable by the bound pipeline to minimize memory usage.
             reUpload = true;
         }
         else
         {
-            // Otherwise, use the following loop to check if any of the spilled user-data entries are dirty.
-            const uint32 firstMaskId = (spillThreshold / UserDataEntriesPerMask);
-            const uint32 lastMaskId = (lastUserData / UserDataEntriesPerMask);
-            for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
+            // Otherwise, check if any of the spilled user-data entries are dirty.
+            reUpload = reUpload || IsAnyUserDataDirty(pUserData, spillThreshold, userDataLimit);
+
+            if ((reUpload == false) && IsAnyUserDataDirty(pUserData, pSpillTable->validFirst, pSpillTable->validLimit))
             {
-                size_t dirtyMask = pUserData->dirty[maskId];
-                if (maskId == firstMaskId)
-                {
-                    // Ignore the dirty bits for any entries below the spill threshold.
-                    const uint32 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~BitfieldGenMask(size_t(firstEntryInMask));
-                }
-                if (maskId == lastMaskId)
-                {
-                    // Ignore the dirty bits for any entries beyond the user-data limit.
-                    const uint32 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= BitfieldGenMask(size_t(lastEntryInMask + 1));
-                }
-
-                if (dirtyMask != 0)
-                {
-                    reUpload = true;
-                    break; // We only care if *any* spill table contents change!
-                }
-            } // for each wide-bitfield sub-mask
+                // Some entries the current copy holds beyond the spilled region have changed. They won't be updated
+                // before the dirty bits are cleared below, so stop treating them as valid.
+                pSpillTable->validFirst = spillThreshold;
+                pSpillTable->validLimit = userDataLimit;
+            }
         }
 
         // Step #3:
@@ -650,6 +634,11 @@ uint32* ComputeCmdBuffer::ValidateUserData(
             }
         }
     } // if current pipeline spills user-data
+    else if (IsAnyUserDataDirty(pUserData, pSpillTable->validFirst, pSpillTable->validLimit))
+    {
+        // Changed entries won't reach the spill table while the bound pipeline doesn't spill.
+        pSpillTable->validLimit = pSpillTable->validFirst;
+    }
 
     // All dirtied user-data entries have been written to user-SGPR's or to the spill table somewhere in this method,
     // so it is safe to clear these bits.
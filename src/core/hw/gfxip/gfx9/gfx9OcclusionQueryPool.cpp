@@ -350,29 +350,48 @@ size_t OcclusionQueryPool::GetResultSizeForOneSlot(
 }
 
 // =====================================================================================================================
-// Helper function to check if the query data is valid. For disabled RBs, the check should always pass but just with a
-// memory barrier inserted.
-static bool IsQueryDataValid(
-    volatile const uint64* pData)
+// Sums the zPass deltas of every RB whose begin and end counters have both been written and returns true if all RBs
+// were ready. The counters are copied out through volatile loads so that every call sees fresh values from the GPU; the
+// summation then runs branch-free over the copies so the compiler can vectorize it across RBs.
+static bool SumRbCounters(
+    uint32                                   numTotalRbs,
+    volatile const OcclusionQueryResultPair* pRbCounters,
+    uint64*                                  pSum)
 {
-    bool result = false;
+    constexpr uint64 ValidMask     = 1ULL << 63;
+    constexpr uint64 ZPassDataMask = ValidMask - 1;
+
+    PAL_ASSERT(numTotalRbs <= MaxNumRbs);
 
-    volatile const uint32* pData32 = reinterpret_cast<volatile const uint32*>(pData);
+    uint64 begin[MaxNumRbs];
+    uint64 end[MaxNumRbs];
 
-    if ((pData32[0] != 0) || (pData32[1] != 0))
+    for (uint32 idx = 0; idx < numTotalRbs; idx++)
     {
-        // The write from the HW isn't atomic at the host/CPU level so we can
-        // end up with half the data.
-        if ((pData32[0] == 0) || (pData32[1] == 0))
-        {
-            // One of the halves appears unwritten. Use memory barrier here to
-            // make sure all writes to this memory from other threads/devices visible to this thread.
-            std::atomic_thread_fence(std::memory_order_acq_rel);
-        }
-        result = true;
+        begin[idx] = pRbCounters[idx].begin.data;
+        end[idx]   = pRbCounters[idx].end.data;
     }
 
-    return result;
+    // Make sure all writes to this memory from other threads/devices are visible to this thread.
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    uint64 sum      = 0;
+    uint64 allValid = ValidMask;
+
+    // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs because
+    // they are initialized to valid with zPassData equal to zero.
+    for (uint32 idx = 0; idx < numTotalRbs; idx++)
+    {
+        const uint64 valid = begin[idx] & end[idx] & ValidMask;
+
+        // Only RBs which are ready may contribute in case the caller asked for partial results.
+        sum      += ((end[idx] & ZPassDataMask) - (begin[idx] & ZPassDataMask)) & (0 - (valid >> 63));
+        allValid &= valid;
+    }
+
+    *pSum = sum;
+
+    return (allValid != 0);
 }
 
 // =====================================================================================================================
@@ -387,35 +406,18 @@ static bool ComputeResultsForOneSlot(
     volatile const OcclusionQueryResultPair* pRbCounters,
     ResultUint*                              pOutputBuffer)
 {
-    ResultUint result     = 0;
-    bool       queryReady = true;
+    uint64 sum        = 0;
+    bool   queryReady = SumRbCounters(numTotalRbs, pRbCounters, &sum);
 
-    // Loop through all the RBs associated with this ASIC.
-    for (uint32 idx = 0; idx < numTotalRbs; idx++)
+    // The GPU could write the counters at any time; we will poll for as long as necessary if the caller requested it.
+    for (uint32 attempt = 0; (queryReady == false) && TestAnyFlagSet(flags, QueryResultWait); attempt++)
     {
-        bool countersReady = false;
-
-        do
-        {
-            // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs
-            // because they are initialized to valid with zPassData equal to zero. We will loop here for as long as
-            // necessary if the caller has requested it.
-            countersReady = IsQueryDataValid(&pRbCounters[idx].begin.data) &&
-                            IsQueryDataValid(&pRbCounters[idx].end.data)   &&
-                            ((pRbCounters[idx].begin.bits.valid == 1) && (pRbCounters[idx].end.bits.valid == 1));
-        }
-        while ((countersReady == false) && TestAnyFlagSet(flags, QueryResultWait));
-
-        if (countersReady)
-        {
-            result += static_cast<ResultUint>(pRbCounters[idx].end.bits.zPassData -
-                                              pRbCounters[idx].begin.bits.zPassData);
-        }
-
-        // The entire query will only be ready if all of its counters were ready.
-        queryReady = queryReady && countersReady;
+        QueryPool::WaitForResultsBackoff(attempt);
+        queryReady = SumRbCounters(numTotalRbs, pRbCounters, &sum);
     }
 
+    ResultUint result = static_cast<ResultUint>(sum);
+
     // Store the result in the output buffer if it's legal for us to do so.
     if (queryReady || TestAnyFlagSet(flags, QueryResultPartial))
     {
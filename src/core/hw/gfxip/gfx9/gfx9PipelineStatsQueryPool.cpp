@@ -569,16 +569,24 @@ static bool AccumulateResultForOneCounter(
     volatile const uint64* pEndCounters,
     ResultUint*            pAccumulatedValue) // Output counter to accumulate. Not modified if counter data is not ready.
 {
-    bool countersReady = false;
+    uint32 attempt       = 0;
+    bool   countersReady = false;
 
     do
     {
+        if (attempt > 0)
+        {
+            // Give up the CPU between polls rather than spinning on memory the GPU hasn't written yet.
+            QueryPool::WaitForResultsBackoff(attempt - 1);
+        }
+
         // If the initial value is still in one of the counters it implies that the query hasn't finished yet.
         // We will loop here for as long as necessary if the caller has requested it.
         countersReady = IsQueryDataValid(&pBeginCounters[counterIndex]) &&
                         IsQueryDataValid(&pEndCounters[counterIndex])   &&
                         ((pBeginCounters[counterIndex] != PipelineStatsResetMemValue64) &&
                          (pEndCounters[counterIndex]   != PipelineStatsResetMemValue64));
+        attempt++;
     }
     while ((countersReady == false) && TestAnyFlagSet(resultFlags, QueryResultWait));
 
@@ -398,9 +398,16 @@ bool StreamoutStatsQueryPool::ComputeResults(
         const StreamoutStatsDataPair* pDataPair = static_cast<const StreamoutStatsDataPair*>(pGpuData);
         StreamoutStatsData* pQueryData = static_cast<StreamoutStatsData*>(pData);
 
-        bool countersReady = false;
+        uint32 attempt       = 0;
+        bool   countersReady = false;
         do
         {
+            if (attempt > 0)
+            {
+                // Give up the CPU between polls rather than spinning on memory the GPU hasn't written yet.
+                QueryPool::WaitForResultsBackoff(attempt - 1);
+            }
+
             // Check if 64bit data is valid first,
             // then AND all 4 counters together and check whether the 63rd bit is 1 or not
             countersReady = IsQueryDataValid(&pDataPair->end.primCountWritten)    &&
@@ -411,6 +418,7 @@ bool StreamoutStatsQueryPool::ComputeResults(
                                pDataPair->begin.primCountWritten   &
                                pDataPair->end.primStorageNeeded    &
                                pDataPair->begin.primStorageNeeded) & StreamoutStatsResultValidMask) != 0);
+            attempt++;
         } while ((countersReady == false) && TestAnyFlagSet(flags, QueryResultWait));
 
         if (countersReady)
@@ -5671,46 +5671,32 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserData(
         {
             const uint16 userDataLimit = m_pSignatureGfx->userDataLimit;
             PAL_ASSERT(userDataLimit > 0);
-            const uint16 lastUserData  = (userDataLimit - 1);
 
             // Step #3:
             // Because the spill table is managed using CPU writes to embedded data, it must be fully re-uploaded for
             // any Draw/Dispatch whenever *any* contents have changed.
             reUpload = (pSpillTable->dirty != 0);
-            if (HasPipelineChanged &&
-                ((spillThreshold < pPrevSignature->spillThreshold) || (userDataLimit > pPrevSignature->userDataLimit)))
+            if ((spillThreshold < pSpillTable->validFirst) || (userDataLimit > pSpillTable->validLimit))
             {
-                // If the pipeline is changing and the spilled region is expanding, we need to re-upload the table
-                // because we normally only update the portions usable by the bound pipeline to minimize memory usage.
+                // The current copy of the table doesn't hold valid data for the whole spilled region. This happens
+                // if the pipeline is changing and the spilled region is expanding because we normally only update
+                // the portions usable by the bound pipeline to minimize memory usage. Note that if the region is
+                // still covered (e.g. when alternating between two pipelines) we can keep using the current copy.
                 reUpload = true;
             }
             else if (anyUserDataDirty)
             {
-                // Otherwise, use the following loop to check if any of the spilled user-data entries are dirty.
-                const uint32 firstMaskId = (spillThreshold / UserDataEntriesPerMask);
-                const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
-                for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
-                {
-                    size_t dirtyMask = pUserDataEntries->dirty[maskId];
-                    if (maskId == firstMaskId)
-                    {
-                        // Ignore the dirty bits for any entries below the spill threshold.
-                        const uint32 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                        dirtyMask &= ~BitfieldGenMask(static_cast<size_t>(firstEntryInMask));
-                    }
-                    if (maskId == lastMaskId)
-                    {
-                        // Ignore the dirty bits for any entries beyond the user-data limit.
-                        const uint32 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                        dirtyMask &= BitfieldGenMask(static_cast<size_t>(lastEntryInMask + 1));
-                    }
+                // Otherwise, check if any of the spilled user-data entries are dirty.
+                reUpload = reUpload || IsAnyUserDataDirty(pUserDataEntries, spillThreshold, userDataLimit);
 
-                    if (dirtyMask != 0)
-                    {
-                        reUpload = true;
-                        break; // We only care if *any* spill table contents change!
-                    }
-                } // for each wide-bitfield sub-mask
+                if ((reUpload == false) &&
+                    IsAnyUserDataDirty(pUserDataEntries, pSpillTable->validFirst, pSpillTable->validLimit))
+                {
+                    // Some entries the current copy holds beyond the spilled region have changed. They won't be
+                    // updated before the dirty bits are cleared below, so stop treating them as valid.
+                    pSpillTable->validFirst = spillThreshold;
+                    pSpillTable->validLimit = userDataLimit;
+                }
             }
 
             // Step #4:
@@ -5742,6 +5728,12 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserData(
                 }
             }
         } // if current pipeline spills user-data
+        else if (anyUserDataDirty &&
+                 IsAnyUserDataDirty(pUserDataEntries, pSpillTable->validFirst, pSpillTable->validLimit))
+        {
+            // Changed entries won't reach the spill table while the bound pipeline doesn't spill.
+            pSpillTable->validLimit = pSpillTable->validFirst;
+        }
 
         // All dirtied user-data entries have been written to user-SGPR's or to the spill table somewhere in this
         // method, so it is safe to clear these bits.
@@ -5930,46 +5922,30 @@ uint32* UniversalCmdBuffer::ValidateComputeUserData(
     {
         const uint16 userDataLimit = pCurrSignature->userDataLimit;
         PAL_ASSERT(userDataLimit != 0);
-        const uint16 lastUserData  = (userDataLimit - 1);
 
         // Step #2:
         // Because the spill table is managed using CPU writes to embedded data, it must be fully re-uploaded for any
         // Dispatch whenever *any* contents have changed.
         bool reUpload = (pSpillTable->dirty != 0);
-        if (HasPipelineChanged &&
-            ((spillThreshold < pPrevSignature->spillThreshold) || (userDataLimit > pPrevSignature->userDataLimit)))
+        if ((spillThreshold < pSpillTable->validFirst) || (userDataLimit > pSpillTable->validLimit))
         {
-            // If the pipeline is changing and the spilled region is expanding, we need to re-upload the table because
-            // we normally only update the portions useable by the bound pipeline to minimize memory usage.
+            // The current copy of the table doesn't hold valid data for the whole spilled region. This happens if the
+            // pipeline is changing and the spilled region is expanding because we normally only update the portions
+            // useable by the bound pipeline to minimize memory usage.
             reUpload = true;
         }
         else
         {
-            // Otherwise, use the following loop to check if any of the spilled user-data entries are dirty.
-            const uint32 firstMaskId = (spillThreshold / UserDataEntriesPerMask);
-            const uint32 lastMaskId  = (lastUserData   / UserDataEntriesPerMask);
-            for (uint32 maskId = firstMaskId; maskId <= lastMaskId; ++maskId)
-            {
-                size_t dirtyMask = pUserData->dirty[maskId];
-                if (maskId == firstMaskId)
-                {
-                    // Ignore the dirty bits for any entries below the spill threshold.
-                    const uint32 firstEntryInMask = (spillThreshold & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= ~BitfieldGenMask(static_cast<size_t>(firstEntryInMask));
-                }
-                if (maskId == lastMaskId)
-                {
-                    // Ignore the dirty bits for any entries beyond the user-data limit.
-                    const uint32 lastEntryInMask = (lastUserData & (UserDataEntriesPerMask - 1));
-                    dirtyMask &= BitfieldGenMask(static_cast<size_t>(lastEntryInMask + 1));
-                }
+            // Otherwise, check if any of the spilled user-data entries are dirty.
+            reUpload = reUpload || IsAnyUserDataDirty(pUserData, spillThreshold, userDataLimit);
 
-                if (dirtyMask != 0)
-                {
-                    reUpload = true;
-                    break; // We only care if *any* spill table contents change!
-                }
-            } // for each wide-bitfield sub-mask
+            if ((reUpload == false) && IsAnyUserDataDirty(pUserData, pSpillTable->validFirst, pSpillTable->validLimit))
+            {
+                // Some entries the current copy holds beyond the spilled region have changed. They won't be updated
+                // before the dirty bits are cleared below, so stop treating them as valid.
+                pSpillTable->validFirst = spillThreshold;
+                pSpillTable->validLimit = userDataLimit;
+            }
         }
 
         // Step #3:
@@ -6023,6 +5999,11 @@ uint32* UniversalCmdBuffer::ValidateComputeUserData(
             }
         }
     } // if current pipeline spills user-data
+    else if (IsAnyUserDataDirty(pUserData, pSpillTable->validFirst, pSpillTable->validLimit))
+    {
+        // Changed entries won't reach the spill table while the bound pipeline doesn't spill.
+        pSpillTable->validLimit = pSpillTable->validFirst;
+    }
 
     const uint16 taskPipeStatsBufRegAddr = pCurrSignature->taskPipeStatsBufRegAddr;
     if (HasPipelineChanged                             &&
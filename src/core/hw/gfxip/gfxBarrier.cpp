@@ -186,47 +186,67 @@ bool GfxBarrierMgr::IsReadOnlyTransition(
 }
 
 // =====================================================================================================================
-// Helper function that takes a BarrierInfo, and splits the SubresRanges in the BarrierTransitions that have multiple
-// planes specified into BarrierTransitions with a single plane SubresRange specified. If the this function allocates
-// memory pMemAllocated is set to true and the caller is responsible for deleting the memory.
-Result GfxBarrierMgr::SplitBarrierTransitions(
-    Platform*    pPlatform,
-    BarrierInfo* pBarrier,      // Copy of a BarrierInfo struct that can have its pTransitions replaced.
-                                // If pTransitions contains imageInfos with SubresRanges that contain
-                                // multiple planes then a new list of transitions will be allocated,
-                                // so that the list of transitions only contain single plane ranges. If
-                                // memory is allocated for a new list of transitions true is returned
-                                // (false otherwise), and the caller is responsible for deleting the
-                                // memory.
-    bool*        pMemAllocated) // If the this function allocates memory true is set and the caller is
-                                // responsible for deleting the memory.
+// Returns the number of BarrierTransitions SplitBarrierTransitions() will produce for the given BarrierInfo, or zero if
+// no transition needs to be split.
+uint32 GfxBarrierMgr::SplitTransitionCount(
+    const BarrierInfo& barrierInfo)
 {
-    PAL_ASSERT(pBarrier != nullptr);
+    uint32 splitCount = 0;
+    for (uint32 i = 0; i < barrierInfo.transitionCount; i++)
+    {
+        const BarrierTransition& transition = barrierInfo.pTransitions[i];
+        splitCount += (transition.imageInfo.pImage != nullptr) ? transition.imageInfo.subresRange.numPlanes : 1;
+    }
 
-    Result result = Result::Success;
+    PAL_ASSERT(splitCount >= barrierInfo.transitionCount);
 
-    *pMemAllocated = false;
+    return (splitCount > barrierInfo.transitionCount) ? splitCount : 0;
+}
 
+// =====================================================================================================================
+// Returns the number of ImgBarriers SplitImgBarriers() will produce for the given AcquireReleaseInfo, or zero if no
+// image barrier needs to be split.
+uint32 GfxBarrierMgr::SplitImgBarrierCount(
+    const AcquireReleaseInfo& barrierInfo)
+{
     uint32 splitCount = 0;
-    for (uint32 i = 0; i < pBarrier->transitionCount; i++)
+    for (uint32 i = 0; i < barrierInfo.imageBarrierCount; i++)
     {
-        const BarrierTransition& transition = pBarrier->pTransitions[i];
-        splitCount += (transition.imageInfo.pImage != nullptr) ? transition.imageInfo.subresRange.numPlanes : 1;
+        splitCount += barrierInfo.pImageBarriers[i].subresRange.numPlanes;
     }
 
-    PAL_ASSERT(splitCount >= pBarrier->transitionCount);
+    PAL_ASSERT(splitCount >= barrierInfo.imageBarrierCount);
+
+    return (splitCount > barrierInfo.imageBarrierCount) ? splitCount : 0;
+}
+
+// =====================================================================================================================
+// Helper function that takes a BarrierInfo, and splits the SubresRanges in the BarrierTransitions that have multiple
+// planes specified into BarrierTransitions with a single plane SubresRange specified. The split transitions are
+// written to pSplitBuffer, which must be at least SplitTransitionCount() elements large.
+Result GfxBarrierMgr::SplitBarrierTransitions(
+    BarrierInfo*           pBarrier,     // Copy of a BarrierInfo struct that can have its pTransitions replaced.
+                                         // If pTransitions contains imageInfos with SubresRanges that contain
+                                         // multiple planes then pTransitions will point into pSplitBuffer, so that
+                                         // the list of transitions only contain single plane ranges.
+    SplitTransitionBuffer* pSplitBuffer) // Storage for the split transitions. It must outlive pBarrier.
+{
+    PAL_ASSERT(pBarrier != nullptr);
+
+    Result result = Result::Success;
+
+    const uint32 splitCount = SplitTransitionCount(*pBarrier);
 
-    if (splitCount > pBarrier->transitionCount)
+    if (splitCount > 0)
     {
-        BarrierTransition* pNewSplitTransitions =
-            PAL_NEW_ARRAY(BarrierTransition, splitCount, pPlatform, AllocInternalTemp);
-        if (pNewSplitTransitions == nullptr)
+        if (pSplitBuffer->Capacity() < splitCount)
         {
+            // The AutoBuffer failed to allocate its heap storage.
             result = Result::ErrorOutOfMemory;
         }
         else
         {
-            *pMemAllocated = true;
+            BarrierTransition* pNewSplitTransitions = pSplitBuffer->Data();
 
             // Copy the transitions to the new memory and split them when necessary.
             uint32 newSplitCount = 0;
@@ -267,44 +287,31 @@ Result GfxBarrierMgr::SplitBarrierTransitions(
 
 // =====================================================================================================================
 // Helper function that takes an AcquireReleaseInfo, and splits the SubresRanges in the ImgBarriers that have multiple
-// planes specified into ImgBarriers with a single plane SubresRanges specified. If the this function allocates memory
-// pMemAllocated is set to true and the caller is responsible for deleting the memory.
+// planes specified into ImgBarriers with a single plane SubresRanges specified. The split barriers are written to
+// pSplitBuffer, which must be at least SplitImgBarrierCount() elements large.
 Result GfxBarrierMgr::SplitImgBarriers(
-    Platform*           pPlatform,
-    AcquireReleaseInfo* pBarrier,      // Copy of a AcquireReleaseInfo struct that can have its pImageBarriers
-                                       // replaced. If pImageBarriers has SubresRanges that contain
-                                       // multiple planes then a new list of image barriers will be allocated,
-                                       // so that the list of barriers only contain single plane ranges. If
-                                       // memory is allocated for a new list of barriers true is returned
-                                       // (false otherwise), and the caller is responsible for deleting the
-                                       // memory.
-    bool*               pMemAllocated) // If the this function allocates memory true is set and the caller is
-                                       // responsible for deleting the memory.
+    AcquireReleaseInfo*    pBarrier,     // Copy of a AcquireReleaseInfo struct that can have its pImageBarriers
+                                         // replaced. If pImageBarriers has SubresRanges that contain multiple
+                                         // planes then pImageBarriers will point into pSplitBuffer, so that the
+                                         // list of barriers only contain single plane ranges.
+    SplitImgBarrierBuffer* pSplitBuffer) // Storage for the split barriers. It must outlive pBarrier.
 {
     PAL_ASSERT(pBarrier != nullptr);
 
     Result result = Result::Success;
 
-    *pMemAllocated = false;
-
-    uint32 splitCount = 0;
-    for (uint32 i = 0; i < pBarrier->imageBarrierCount; i++)
-    {
-        splitCount += pBarrier->pImageBarriers[i].subresRange.numPlanes;
-    }
-
-    PAL_ASSERT(splitCount >= pBarrier->imageBarrierCount);
+    const uint32 splitCount = SplitImgBarrierCount(*pBarrier);
 
-    if (splitCount > pBarrier->imageBarrierCount)
+    if (splitCount > 0)
     {
-        ImgBarrier* pNewSplitTransitions = PAL_NEW_ARRAY(ImgBarrier, splitCount, pPlatform, AllocInternalTemp);
-        if (pNewSplitTransitions == nullptr)
+        if (pSplitBuffer->Capacity() < splitCount)
         {
+            // The AutoBuffer failed to allocate its heap storage.
             result = Result::ErrorOutOfMemory;
         }
         else
         {
-            *pMemAllocated = true;
+            ImgBarrier* pNewSplitTransitions = pSplitBuffer->Data();
 
             // Copy the transitions to the new memory and split them when necessary.
             uint32 newSplitCount = 0;
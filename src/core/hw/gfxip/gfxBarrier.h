@@ -28,6 +28,7 @@
 #include "pal.h"
 #include "palCmdBuffer.h"
 #include "palDeveloperHooks.h"
+#include "palAutoBuffer.h"
 
 namespace Pal
 {
@@ -186,15 +187,23 @@ public:
     void DescribeBarrierStart(GfxCmdBuffer* pGfxCmdBuf, uint32 reason, Developer::BarrierType type) const;
     void DescribeBarrierEnd(GfxCmdBuffer* pGfxCmdBuf, Developer::BarrierOperations* pOperations) const;
 
+    // Scratch storage for the split barrier lists. Most barriers fit in the inline storage, so splitting them doesn't
+    // touch the heap. The buffers should be sized using the matching SplitCount functions.
+    static constexpr uint32 InlineSplitBarrierCount = 16;
+
+    using SplitTransitionBuffer = Util::AutoBuffer<BarrierTransition, InlineSplitBarrierCount, Platform>;
+    using SplitImgBarrierBuffer = Util::AutoBuffer<ImgBarrier, InlineSplitBarrierCount, Platform>;
+
+    static uint32 SplitTransitionCount(const BarrierInfo& barrierInfo);
+    static uint32 SplitImgBarrierCount(const AcquireReleaseInfo& barrierInfo);
+
     static Result SplitBarrierTransitions(
-        Platform*    pPlatform,
-        BarrierInfo* pBarrier,
-        bool*        pMemAllocated);
+        BarrierInfo*           pBarrier,
+        SplitTransitionBuffer* pSplitBuffer);
 
     static Result SplitImgBarriers(
-        Platform*           pPlatform,
-        AcquireReleaseInfo* pBarrier,
-        bool*               pMemAllocated);
+        AcquireReleaseInfo*    pBarrier,
+        SplitImgBarrierBuffer* pSplitBuffer);
 
     static void SetBarrierOperationsRbCacheSynced(Developer::BarrierOperations* pOperations)
     {
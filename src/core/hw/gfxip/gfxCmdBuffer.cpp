@@ -95,7 +95,12 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_acqRelFenceVals{},
     m_retiredAcqRelFenceVals{},
     m_executeIndirectV2GlobalSpill(NoExecuteIndirectV2),
-    m_globalInternalTableAddr(0)
+    m_globalInternalTableAddr(0),
+    m_embeddedDataDedup(device.Parent()->Settings().cmdBufEmbeddedDataDedup),
+    m_embeddedDataDedupCache{}
+#if PAL_DEVELOPER_BUILD
+    , m_embeddedDataDedupStats{}
+#endif
 {
     PAL_ASSERT((createInfo.queueType == QueueTypeUniversal) || (createInfo.queueType == QueueTypeCompute));
 
@@ -111,6 +116,18 @@ GfxCmdBuffer::GfxCmdBuffer(
 // =====================================================================================================================
 GfxCmdBuffer::~GfxCmdBuffer()
 {
+#if PAL_DEVELOPER_BUILD
+    // Report the totals once, over every recording of this command buffer, rather than on every End().
+    if (m_embeddedDataDedupStats.lookups > 0)
+    {
+        PAL_DPINFO("Embedded data dedup: %llu/%llu hits, %llu bytes saved, %llu bytes hashed.",
+                   m_embeddedDataDedupStats.hits,
+                   m_embeddedDataDedupStats.lookups,
+                   m_embeddedDataDedupStats.bytesSaved,
+                   m_embeddedDataDedupStats.bytesHashed);
+    }
+#endif
+
     ResetFastClearReferenceCounts();
 
     PAL_SAFE_FREE(m_computeState.pKernelArguments, m_device.GetPlatform());
@@ -272,6 +289,13 @@ void GfxCmdBuffer::ResetState()
 
     m_cmdBufState.flags.u32All           = 0;
     m_cmdBufState.flags.prevCmdBufActive = 1;
+    m_cmdBufState.prevBarrierSync        = {};
+
+    if (m_embeddedDataDedup)
+    {
+        // Embedded data from the previous recording is about to be reused, forget everything we've cached.
+        memset(m_embeddedDataDedupCache, 0, sizeof(m_embeddedDataDedupCache));
+    }
 
     // It's possible that another of our command buffers still has blts in flight, except for CP blts which must be
     // flushed in each command buffer postamble.
@@ -418,6 +442,42 @@ bool GfxCmdBuffer::IsAnyUserDataDirty(
     return (dirty != 0);
 }
 
+// =====================================================================================================================
+// Returns true if any of the user-data entries in the range [firstEntry, entryLimit) are dirty.
+bool GfxCmdBuffer::IsAnyUserDataDirty(
+    const UserDataEntries* pUserDataEntries,
+    uint32                 firstEntry,
+    uint32                 entryLimit)
+{
+    bool dirty = false;
+
+    if (firstEntry < entryLimit)
+    {
+        const uint32 lastEntry   = (entryLimit - 1);
+        const uint32 firstMaskId = (firstEntry / UserDataEntriesPerMask);
+        const uint32 lastMaskId  = (lastEntry  / UserDataEntriesPerMask);
+
+        for (uint32 maskId = firstMaskId; (maskId <= lastMaskId) && (dirty == false); ++maskId)
+        {
+            size_t dirtyMask = pUserDataEntries->dirty[maskId];
+            if (maskId == firstMaskId)
+            {
+                // Ignore the dirty bits for any entries below the range.
+                dirtyMask &= ~BitfieldGenMask(size_t(firstEntry & (UserDataEntriesPerMask - 1)));
+            }
+            if (maskId == lastMaskId)
+            {
+                // Ignore the dirty bits for any entries beyond the range.
+                dirtyMask &= BitfieldGenMask(size_t((lastEntry & (UserDataEntriesPerMask - 1)) + 1));
+            }
+
+            dirty = (dirtyMask != 0);
+        }
+    }
+
+    return dirty;
+}
+
 // =====================================================================================================================
 // Puts command stream related objects into a state ready for command building.
 Result GfxCmdBuffer::BeginCommandStreams(
@@ -1487,11 +1547,10 @@ void GfxCmdBuffer::CmdBarrier(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         BarrierInfo splitBarrierInfo = barrierInfo;
-        Result result = GfxBarrierMgr::SplitBarrierTransitions(m_device.GetPlatform(),
-                                                               &splitBarrierInfo,
-                                                               &splitMemAllocated);
+        GfxBarrierMgr::SplitTransitionBuffer splitTransitions(GfxBarrierMgr::SplitTransitionCount(barrierInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitBarrierTransitions(&splitBarrierInfo, &splitTransitions);
 
         if (result == Result::Success)
         {
@@ -1505,12 +1564,6 @@ void GfxCmdBuffer::CmdBarrier(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting the BarrierTransitions if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitBarrierInfo.pTransitions, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -1544,9 +1597,10 @@ ReleaseToken GfxCmdBuffer::CmdRelease(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         AcquireReleaseInfo splitReleaseInfo = releaseInfo;
-        Result result = GfxBarrierMgr::SplitImgBarriers(m_device.GetPlatform(), &splitReleaseInfo, &splitMemAllocated);
+        GfxBarrierMgr::SplitImgBarrierBuffer splitImgBarriers(GfxBarrierMgr::SplitImgBarrierCount(releaseInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitImgBarriers(&splitReleaseInfo, &splitImgBarriers);
 
         if (result == Result::Success)
         {
@@ -1560,12 +1614,6 @@ ReleaseToken GfxCmdBuffer::CmdRelease(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting ImgBarriers if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitReleaseInfo.pImageBarriers, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -1606,9 +1654,10 @@ void GfxCmdBuffer::CmdAcquire(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         AcquireReleaseInfo splitAcquireInfo = acquireInfo;
-        Result result = GfxBarrierMgr::SplitImgBarriers(m_device.GetPlatform(), &splitAcquireInfo, &splitMemAllocated);
+        GfxBarrierMgr::SplitImgBarrierBuffer splitImgBarriers(GfxBarrierMgr::SplitImgBarrierCount(acquireInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitImgBarriers(&splitAcquireInfo, &splitImgBarriers);
 
         if (result == Result::Success)
         {
@@ -1627,12 +1676,6 @@ void GfxCmdBuffer::CmdAcquire(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting ImgBarriers if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitAcquireInfo.pImageBarriers, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -1667,9 +1710,10 @@ void GfxCmdBuffer::CmdReleaseEvent(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         AcquireReleaseInfo splitReleaseInfo = releaseInfo;
-        Result result = GfxBarrierMgr::SplitImgBarriers(m_device.GetPlatform(), &splitReleaseInfo, &splitMemAllocated);
+        GfxBarrierMgr::SplitImgBarrierBuffer splitImgBarriers(GfxBarrierMgr::SplitImgBarrierCount(releaseInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitImgBarriers(&splitReleaseInfo, &splitImgBarriers);
 
         if (result == Result::Success)
         {
@@ -1683,12 +1727,6 @@ void GfxCmdBuffer::CmdReleaseEvent(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting ImgBarriers if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitReleaseInfo.pImageBarriers, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -1719,9 +1757,10 @@ void GfxCmdBuffer::CmdAcquireEvent(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         AcquireReleaseInfo splitAcquireInfo = acquireInfo;
-        Result result = GfxBarrierMgr::SplitImgBarriers(m_device.GetPlatform(), &splitAcquireInfo, &splitMemAllocated);
+        GfxBarrierMgr::SplitImgBarrierBuffer splitImgBarriers(GfxBarrierMgr::SplitImgBarrierCount(acquireInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitImgBarriers(&splitAcquireInfo, &splitImgBarriers);
 
         if (result == Result::Success)
         {
@@ -1735,12 +1774,6 @@ void GfxCmdBuffer::CmdAcquireEvent(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting ImgBarriers if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitAcquireInfo.pImageBarriers, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -1769,9 +1802,10 @@ void GfxCmdBuffer::CmdReleaseThenAcquire(
 
     if (m_splitBarriers)
     {
-        bool splitMemAllocated;
         AcquireReleaseInfo splitBarrierInfo = barrierInfo;
-        Result result = GfxBarrierMgr::SplitImgBarriers(m_device.GetPlatform(), &splitBarrierInfo, &splitMemAllocated);
+        GfxBarrierMgr::SplitImgBarrierBuffer splitImgBarriers(GfxBarrierMgr::SplitImgBarrierCount(barrierInfo),
+                                                              m_device.GetPlatform());
+        Result result = GfxBarrierMgr::SplitImgBarriers(&splitBarrierInfo, &splitImgBarriers);
 
         if (result == Result::Success)
         {
@@ -1785,12 +1819,6 @@ void GfxCmdBuffer::CmdReleaseThenAcquire(
         {
             PAL_ASSERT_ALWAYS();
         }
-
-        // Delete memory allocated for splitting ImgBarriers if necessary.
-        if (splitMemAllocated)
-        {
-            PAL_SAFE_DELETE_ARRAY(splitBarrierInfo.pImageBarriers, m_device.GetPlatform());
-        }
     }
     else
     {
@@ -2134,9 +2162,20 @@ void GfxCmdBuffer::UpdateUserDataTableCpu(
     // such that this command buffer must allocate an additional embedded data chunk.
     const uint32 cbAlignment = Max(alignmentInDwords, 4u);
 
-    gpusize gpuVirtAddr  = 0uLL;
-    pTable->pCpuVirtAddr = (CmdAllocateEmbeddedData(dwordsNeeded, cbAlignment, &gpuVirtAddr) - offsetInDwords);
+    pSrcData += offsetInDwords;
+
+    gpusize gpuVirtAddr   = 0uLL;
+    bool    alreadyExists = false;
+    uint32* pDstData      = CmdAllocateEmbeddedDataDedup(pSrcData,
+                                                         dwordsNeeded,
+                                                         cbAlignment,
+                                                         &gpuVirtAddr,
+                                                         &alreadyExists);
+
+    pTable->pCpuVirtAddr = (pDstData - offsetInDwords);
     pTable->gpuVirtAddr  = (gpuVirtAddr - (sizeof(uint32) * offsetInDwords));
+    pTable->validFirst   = uint16(offsetInDwords);
+    pTable->validLimit   = uint16(offsetInDwords + dwordsNeeded);
 
     // There's technically a bug in the above table address calculation. We only write the low 32-bits of the table
     // address to user-data and assume the high bits are always the same. This is usually the case because we allocate
@@ -2152,20 +2191,22 @@ void GfxCmdBuffer::UpdateUserDataTableCpu(
     //    can never allocate embeded data in the range that can underflow. This will waste VA space and seems hacky.
     PAL_DEBUG_BUILD_ONLY_ASSERT(HighPart(gpuVirtAddr) == HighPart(pTable->gpuVirtAddr));
 
-    // Optimize the loop with a memcpy if dwordsNeeded is large enough ( 6 DWORDs is the threshold measured )
-    uint32* pDstData = (pTable->pCpuVirtAddr + offsetInDwords);
-    pSrcData += offsetInDwords;
-    if (dwordsNeeded >= 6)
+    // Nothing needs to be copied if we're pointing at an identical window which was uploaded earlier.
+    if (alreadyExists == false)
     {
-        memcpy(pDstData, pSrcData, dwordsNeeded * sizeof(uint32));
-    }
-    else
-    {
-        for (uint32 i = 0; i < dwordsNeeded; ++i)
+        // Optimize the loop with a memcpy if dwordsNeeded is large enough ( 6 DWORDs is the threshold measured )
+        if (dwordsNeeded >= 6)
         {
-            *pDstData = *pSrcData;
-            ++pDstData;
-            ++pSrcData;
+            memcpy(pDstData, pSrcData, dwordsNeeded * sizeof(uint32));
+        }
+        else
+        {
+            for (uint32 i = 0; i < dwordsNeeded; ++i)
+            {
+                *pDstData = *pSrcData;
+                ++pDstData;
+                ++pSrcData;
+            }
         }
     }
 
@@ -2173,6 +2214,71 @@ void GfxCmdBuffer::UpdateUserDataTableCpu(
     pTable->dirty = 0;
 }
 
+// =====================================================================================================================
+// Allocates embedded data for a payload whose contents are known up front. If the embedded data dedup cache is enabled
+// and an identical payload was already written to this command buffer with a compatible alignment, that allocation is
+// returned instead and pAlreadyExists is set to true. Otherwise a new allocation is returned and the caller must copy
+// pSrcData into it.
+uint32* GfxCmdBuffer::CmdAllocateEmbeddedDataDedup(
+    const uint32* pSrcData,
+    uint32        sizeInDwords,
+    uint32        alignmentInDwords,
+    gpusize*      pGpuAddress,
+    bool*         pAlreadyExists)
+{
+    uint32* pCpuAddr = nullptr;
+
+    *pAlreadyExists = false;
+
+    if (m_embeddedDataDedup && (sizeInDwords > 0))
+    {
+        // We never read embedded data back (it's likely in write-combined memory) so the 128-bit content hash alone
+        // must identify a payload.
+        const uint32 sizeInBytes = sizeInDwords * sizeof(uint32);
+
+        MetroHash::Hash hash = {};
+        MetroHash128::Hash(reinterpret_cast<const uint8*>(pSrcData), sizeInBytes, hash.bytes);
+
+        EmbeddedDataDedupEntry*const pEntry =
+            &m_embeddedDataDedupCache[MetroHash::Compact32(&hash) % EmbeddedDataDedupEntries];
+
+#if PAL_DEVELOPER_BUILD
+        m_embeddedDataDedupStats.lookups++;
+        m_embeddedDataDedupStats.bytesHashed += sizeInBytes;
+#endif
+
+        if ((pEntry->sizeInDwords   == sizeInDwords)   &&
+            (pEntry->hash.qwords[0] == hash.qwords[0]) &&
+            (pEntry->hash.qwords[1] == hash.qwords[1]) &&
+            IsPow2Aligned(pEntry->gpuVirtAddr, alignmentInDwords * sizeof(uint32)))
+        {
+            pCpuAddr        = pEntry->pCpuAddr;
+            *pGpuAddress    = pEntry->gpuVirtAddr;
+            *pAlreadyExists = true;
+
+#if PAL_DEVELOPER_BUILD
+            m_embeddedDataDedupStats.hits++;
+            m_embeddedDataDedupStats.bytesSaved += sizeInBytes;
+#endif
+        }
+        else
+        {
+            pCpuAddr = CmdAllocateEmbeddedData(sizeInDwords, alignmentInDwords, pGpuAddress);
+
+            pEntry->hash         = hash;
+            pEntry->pCpuAddr     = pCpuAddr;
+            pEntry->gpuVirtAddr  = *pGpuAddress;
+            pEntry->sizeInDwords = sizeInDwords;
+        }
+    }
+    else
+    {
+        pCpuAddr = CmdAllocateEmbeddedData(sizeInDwords, alignmentInDwords, pGpuAddress);
+    }
+
+    return pCpuAddr;
+}
+
 // =====================================================================================================================
 // Disables all queries on this command buffer, stopping them and marking them as unavailable.
 void GfxCmdBuffer::DeactivateQueries()
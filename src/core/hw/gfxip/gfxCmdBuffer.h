@@ -34,6 +34,7 @@
 #include "gfxCmdStream.h"
 #include "palDeque.h"
 #include "palHashMap.h"
+#include "palMetroHash.h"
 #include "palQueryPool.h"
 
 namespace Util
@@ -147,6 +148,10 @@ struct UserDataTableState
         uint32  dirty        : 1;  // Indicates that the CPU copy of the user-data table is more up to date than the
                                    // copy currently in GPU memory and should be updated before the next dispatch.
     };
+    // The current copy of the table only holds up-to-date data for entries in the range [validFirst, validLimit).
+    // This starts out as the window which was uploaded and can only shrink until the next upload.
+    uint16  validFirst;
+    uint16  validLimit;
 };
 
 union GfxCmdBufferStateFlags
@@ -196,6 +201,17 @@ struct GfxCmdBufferState
         uint32 csBltExecEopFenceVal;        // Earliest EOP fence value that can confirm all CS BLTs are complete.
         uint32 csBltExecCsDoneFenceVal;     // Earliest CS_DONE fence value that can confirm all CS BLTs are complete.
     } fences;
+
+    // The most recent release-then-acquire sync written by the HWL barrier manager. A following sync which is fully
+    // covered by this one can be skipped if no commands were written to the main command stream in between.
+    struct
+    {
+        uint64 cmdStreamPos;  // Main command stream write position just after the sync was written.
+        uint32 srcStageMask;  // Released pipeline stages.
+        uint32 hwCacheOps;    // Opaque HWL cache sync operations.
+        uint8  hwAcqPoint;    // Opaque HWL acquire point.
+        bool   valid;         // If the rest of this structure is valid.
+    } prevBarrierSync;
 };
 
 enum ExecuteIndirectV2GlobalSpill
@@ -477,6 +493,7 @@ public:
     bool SqttClosed()  const { return m_cmdBufState.flags.sqttStopped; }
 
     static bool IsAnyUserDataDirty(const UserDataEntries* pUserDataEntries);
+    static bool IsAnyUserDataDirty(const UserDataEntries* pUserDataEntries, uint32 firstEntry, uint32 entryLimit);
 
     virtual void CmdBindPipelineWithOverrides(
         const PipelineBindParams& params,
@@ -560,6 +577,15 @@ public:
 
     uint32 GetPacketPredicate() const { return m_cmdBufState.flags.packetPredicate; }
 
+    void SetPrevBarrierSync(uint32 srcStageMask, uint32 hwCacheOps, uint8 hwAcqPoint)
+    {
+        m_cmdBufState.prevBarrierSync.cmdStreamPos = m_pCmdStream->GetWritePosition();
+        m_cmdBufState.prevBarrierSync.srcStageMask = srcStageMask;
+        m_cmdBufState.prevBarrierSync.hwCacheOps   = hwCacheOps;
+        m_cmdBufState.prevBarrierSync.hwAcqPoint   = hwAcqPoint;
+        m_cmdBufState.prevBarrierSync.valid        = true;
+    }
+
     // Note that this function only checks if BLT stall has been completed but not cache flushed.
     bool AnyBltActive() const { return (m_cmdBufState.flags.cpBltActive | m_cmdBufState.flags.csBltActive |
                                         m_cmdBufState.flags.gfxBltActive) != 0; }
@@ -722,6 +748,13 @@ protected:
         const uint32*       pSrcData,
         uint32              alignmentInDwords = 1);
 
+    uint32* CmdAllocateEmbeddedDataDedup(
+        const uint32* pSrcData,
+        uint32        sizeInDwords,
+        uint32        alignmentInDwords,
+        gpusize*      pGpuAddress,
+        bool*         pAlreadyExists);
+
     // Returns the number of queries associated with this command buffer that have yet to "end"
     uint32 NumActiveQueries(QueryPoolType queryPoolType) const
         { return m_numActiveQueries[static_cast<size_t>(queryPoolType)]; }
@@ -770,6 +803,8 @@ protected:
         pTable->pCpuVirtAddr = nullptr;
         pTable->gpuVirtAddr  = 0;
         pTable->dirty        = 0;
+        pTable->validFirst   = 0;
+        pTable->validLimit   = 0;
     }
 
     static void UpdateUserData(
@@ -878,6 +913,32 @@ private:
     // SpilledUserData Tables that will use the Global SpillTable Buffer.
     ExecuteIndirectV2GlobalSpill m_executeIndirectV2GlobalSpill;
 
+    // A small direct-mapped cache of embedded data payloads already written to this command buffer, keyed by a hash of
+    // their contents. Lets identical payloads (e.g., repeated spill tables) share one embedded data allocation.
+    struct EmbeddedDataDedupEntry
+    {
+        Util::MetroHash::Hash hash;         // Hash of the payload's contents.
+        uint32*               pCpuAddr;     // CPU address of the payload in embedded data.
+        gpusize               gpuVirtAddr;  // GPU address of the payload in embedded data.
+        uint32                sizeInDwords; // Payload size; zero marks an empty entry.
+    };
+
+    static constexpr uint32 EmbeddedDataDedupEntries = 64;
+
+    const bool             m_embeddedDataDedup;   // If the dedup cache below is enabled for this command buffer.
+    EmbeddedDataDedupEntry m_embeddedDataDedupCache[EmbeddedDataDedupEntries];
+
+#if PAL_DEVELOPER_BUILD
+    // Totals over every recording of this command buffer. They're reported when it is destroyed.
+    struct
+    {
+        uint64 lookups;     // Number of payloads checked against the cache.
+        uint64 hits;        // Number of payloads which reused an existing allocation.
+        uint64 bytesHashed; // Total payload bytes hashed; the per-call overhead of deduplication.
+        uint64 bytesSaved;  // Total embedded data bytes not allocated thanks to deduplication.
+    } m_embeddedDataDedupStats;
+#endif
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdBuffer);
 };
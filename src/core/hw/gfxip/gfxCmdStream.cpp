@@ -62,7 +62,8 @@ GfxCmdStream::GfxCmdStream(
     m_cmdBlockOffset(0),
     m_pTailChainLocation(nullptr),
     m_numCntlFlowStatements(0),
-    m_numPendingChains(0)
+    m_numPendingChains(0),
+    m_pPrevCalleeTail(nullptr)
 {
     memset(m_cntlFlowStack, 0, sizeof(m_cntlFlowStack));
     memset(m_pendingChains, 0, sizeof(m_pendingChains));
@@ -78,6 +79,7 @@ void GfxCmdStream::Reset(
     m_numCntlFlowStatements = 0;
     m_numPendingChains      = 0;
     m_pTailChainLocation    = nullptr;
+    m_pPrevCalleeTail       = nullptr;
 
     Pal::CmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
@@ -462,6 +464,68 @@ void GfxCmdStream::PatchTailChain(
     }
 }
 
+// =====================================================================================================================
+// Calls a command stream which supports chaining and belongs to a command buffer with the exclusive submit optimization
+// enabled. We only need to jump to the callee's first chunk, and then jump back here when the callee finishes.
+//
+// Nested command buffers recorded in parallel are typically executed back-to-back. If nothing has been written to this
+// stream since the previous callee was chained in, the previous callee's tail jumps straight into the next callee so
+// the CP doesn't have to fetch an empty command block between them. Only the last callee in such a run returns to us.
+void GfxCmdStream::ChainCall(
+    const GfxCmdStream& targetStream)
+{
+    const auto*const pJumpChunk = targetStream.GetFirstChunk();
+
+    const bool blockIsEmpty = (m_chunkList.IsEmpty() == false) &&
+                              (m_chunkList.Back()->DwordsAllocated() == m_cmdBlockOffset);
+
+    if (blockIsEmpty                                                   &&
+        (m_pPrevCalleeTail != nullptr)                                 &&
+        (m_pPrevCalleeTail != targetStream.m_pTailChainLocation)       &&
+        (m_numPendingChains == 1)                                      &&
+        (m_pendingChains[0].type    == ChainPatchType::IndirectBuffer) &&
+        (m_pendingChains[0].pPacket == m_pPrevCalleeTail))
+    {
+        // Chain the previous callee directly into this one and move the pending return patch to this callee's tail.
+        BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
+                            pJumpChunk->CmdDwordsToExecute(),
+                            targetStream.IsPreemptionEnabled(),
+                            true,
+                            m_pPrevCalleeTail);
+
+        m_pendingChains[0].pPacket = targetStream.m_pTailChainLocation;
+    }
+    else
+    {
+        if (IsEmpty())
+        {
+            // The call to EndCommandBlock() below will not succeed if this command stream is currently empty. Add
+            // the smallest-possible NOP packet to prevent the stream from being empty.
+            uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
+            BuildNop(m_minNopSizeInDwords, pNopPacket);
+        }
+
+        // End our current command block, using the jump to the callee's first chunk as our block postamble.
+        uint32*const pChainPacket = EndCommandBlock(m_chainIbSpaceInDwords, false);
+        BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
+                            pJumpChunk->CmdDwordsToExecute(),
+                            targetStream.IsPreemptionEnabled(),
+                            true,
+                            pChainPacket);
+
+        // Returning to the call site requires patching the callee's tail-chain with a packet which brings us
+        // back here. However, we need to know the size of the current command block in order to fully construct
+        // a chaining packet. So, the solution is to add a chain patch at the callee's tail-chain location which
+        // will correspond to the current block.
+
+        // NOTE: The callee's End() method was called after it was done being recorded. That call already built
+        // us a dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
+        AddChainPatch(ChainPatchType::IndirectBuffer, targetStream.m_pTailChainLocation);
+    }
+
+    m_pPrevCalleeTail = targetStream.m_pTailChainLocation;
+}
+
 // =====================================================================================================================
 // Specialized implementation of "Call" for GFXIP command streams.  This will attempt to use either an IB2 packet or
 // take advantage of command buffer chaining instead of just copying the callee's command stream contents into this
@@ -518,34 +582,7 @@ void GfxCmdStream::Call(
         }
         else if (exclusiveSubmit && (m_chainIbSpaceInDwords != 0) && (gfxStream.m_chainIbSpaceInDwords != 0))
         {
-            // NOTE: To call a command stream which supports chaining and has the exclusive submit optmization enabled,
-            // we only need to jump to the callee's first chunk, and then jump back here when the callee finishes.
-
-            if (IsEmpty())
-            {
-                // The call to EndCommandBlock() below will not succeed if this command stream is currently empty. Add
-                // the smallest-possible NOP packet to prevent the stream from being empty.
-                uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
-                BuildNop(m_minNopSizeInDwords, pNopPacket);
-            }
-
-            // End our current command block, using the jump to the callee's first chunk as our block postamble.
-            const auto*const pJumpChunk   = targetStream.GetFirstChunk();
-            uint32*const     pChainPacket = EndCommandBlock(m_chainIbSpaceInDwords, false);
-            BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
-                                pJumpChunk->CmdDwordsToExecute(),
-                                targetStream.IsPreemptionEnabled(),
-                                true,
-                                pChainPacket);
-
-            // Returning to the call site requires patching the callee's tail-chain with a packet which brings us
-            // back here. However, we need to know the size of the current command block in order to fully construct
-            // a chaining packet. So, the solution is to add a chain patch at the callee's tail-chain location which
-            // will correspond to the current block.
-
-            // NOTE: The callee's End() method was called after it was done being recorded. That call already built
-            // us a dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
-            AddChainPatch(ChainPatchType::IndirectBuffer, gfxStream.m_pTailChainLocation);
+            ChainCall(gfxStream);
         }
         else
         {
@@ -125,6 +125,8 @@ protected:
 
     uint32  CmdBlockOffset() const { return m_cmdBlockOffset; }
 
+    void ChainCall(const GfxCmdStream& targetStream);
+
     uint32* EndCommandBlock(
         uint32    postambleDwords,
         bool      atEndOfChunk,
@@ -174,6 +176,10 @@ private:
     ChainPatch     m_pendingChains[MaxChainPatches];
     uint32         m_numPendingChains;
 
+    // Tail-chain location of the most recent exclusive-submit callee we chained to. If its return patch is still
+    // pending when the next callee is chained, the two callees are linked directly. See ChainCall().
+    uint32*        m_pPrevCalleeTail;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdStream);
 };
@@ -27,6 +27,8 @@
 #include "core/eventDefs.h"
 #include "core/hw/gfxip/gfxCmdBuffer.h"
 #include "core/hw/gfxip/queryPool.h"
+#include "palMutex.h"
+#include "palSysUtil.h"
 
 using namespace Util;
 
@@ -188,6 +190,25 @@ Result QueryPool::GetResults(
     return result;
 }
 
+// =====================================================================================================================
+// Backs off between failed polls of the CPU-visible query results so that QueryResultWait doesn't burn a whole core
+// when the GPU is far from done. The first few polls only give up the rest of the time slice because most queries are
+// read shortly after they were written; after that we sleep in short, bounded intervals.
+void QueryPool::WaitForResultsBackoff(
+    uint32 attempt)
+{
+    constexpr uint32 MaxYieldAttempts = 64;
+
+    if (attempt < MaxYieldAttempts)
+    {
+        YieldThread();
+    }
+    else
+    {
+        Util::Sleep(std::chrono::milliseconds(1));
+    }
+}
+
 // =====================================================================================================================
 // Verifies that the specified slot is supported by this query pool.
 Result QueryPool::ValidateSlot(
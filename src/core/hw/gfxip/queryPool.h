@@ -120,6 +120,10 @@ public:
 
     Result ValidateSlot(uint32 slot) const;
 
+    // Called between polls of the query results when QueryResultWait is set. attempt is the number of polls which
+    // have failed so far for the current query.
+    static void WaitForResultsBackoff(uint32 attempt);
+
 protected:
     QueryPool(const Device&              device,
               const QueryPoolCreateInfo& createInfo,
@@ -95,1366 +95,96 @@ static const PipelineBinary*const GetRpmComputePipelineTable(
 }
 
 // =====================================================================================================================
-// Creates all compute pipeline objects required by RsrcProcMgr.
-Result CreateRpmComputePipelines(
-    GfxDevice*        pDevice,
-    ComputePipeline** pPipelineMem)
+// Creates a single compute pipeline object required by RsrcProcMgr. If the pipeline has no binary for this device,
+// *ppPipeline is left untouched.
+Result CreateRpmComputePipeline(
+    GfxDevice*         pDevice,
+    RpmComputePipeline pipeline,
+    ComputePipeline**  ppPipeline)
 {
     Result result = Result::Success;
 
     const GpuChipProperties& properties = pDevice->Parent()->ChipProperties();
     const PipelineBinary*const pTable   = GetRpmComputePipelineTable(properties);
+    const uint32               index    = uint32(pipeline);
 
     if (pTable == nullptr)
     {
         PAL_NOT_IMPLEMENTED();
-        return Result::ErrorUnknown;
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ClearBuffer)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ClearBuffer);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ClearImage96Bpp)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ClearImage96Bpp);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ClearImage)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ClearImage);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ClearImageMsaaPlanar)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ClearImageMsaaPlanar);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ClearImageMsaaSampleMajor)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ClearImageMsaaSampleMajor);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyBufferByte)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyBufferByte);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyBufferDqword)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyBufferDqword);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyBufferDword)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyBufferDword);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dMorton2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dMorton2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dMorton4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dMorton4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dMorton8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dMorton8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dms2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dms2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dms4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dms4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dms8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dms8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImage2dShaderMipLevel)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImage2dShaderMipLevel);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImageGammaCorrect2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImageGammaCorrect2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem1d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem1d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem2dms2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem2dms2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem2dms4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem2dms4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem2dms8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem2dms8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyImgToMem3d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyImgToMem3d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg1d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg1d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg2dms2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg2dms2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg2dms4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg2dms4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg2dms8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg2dms8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyMemToImg3d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyMemToImg3d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyTypedBuffer1d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyTypedBuffer1d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyTypedBuffer2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyTypedBuffer2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::CopyTypedBuffer3d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::CopyTypedBuffer3d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ExpandMaskRam)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ExpandMaskRam);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ExpandMaskRamMs2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ExpandMaskRamMs2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
+        result = Result::ErrorUnknown;
     }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ExpandMaskRamMs4x)].pBuffer != nullptr))
+    else if (pTable[index].pBuffer != nullptr)
     {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ExpandMaskRamMs4x);
-
         ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
+        pipeInfo.pPipelineBinary           = pTable[index].pBuffer;
+        pipeInfo.pipelineBinarySize        = pTable[index].size;
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ExpandMaskRamMs8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ExpandMaskRamMs8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
+        switch (pipeline)
+        {
+        case RpmComputePipeline::FillMem4xDword:
+        case RpmComputePipeline::FillMemDword:
+        case RpmComputePipeline::Gfx9EchoGlobalTable:
+#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
+        case RpmComputePipeline::Gfx12EchoGlobalTable:
+        case RpmComputePipeline::Gfx12FillMem128b:
+        case RpmComputePipeline::Gfx12FillMem128bNoalloc:
+#endif
+            pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
+            break;
+        default:
+            break;
+        }
 
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
+        result = pDevice->CreateComputePipelineInternal(pipeInfo, ppPipeline, AllocInternal);
     }
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::FastDepthClear)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::FastDepthClear);
+    return result;
+}
 
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
+// =====================================================================================================================
+// Checks that every compute pipeline required by RsrcProcMgr can be created for this device without creating any of
+// them: this device must have a binary table and every binary in it must be a well-formed code object. Pipelines that
+// are created on first use rely on this having succeeded so that only running out of memory can make creating them
+// fail.
+Result ValidateRpmComputePipelines(
+    GfxDevice* pDevice)
+{
+    Result result = Result::Success;
 
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
+    const GpuChipProperties& properties = pDevice->Parent()->ChipProperties();
+    const PipelineBinary*const pTable   = GetRpmComputePipelineTable(properties);
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::FastDepthExpClear)].pBuffer != nullptr))
+    if (pTable == nullptr)
     {
-        constexpr uint32 Index = uint32(RpmComputePipeline::FastDepthExpClear);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
+        PAL_NOT_IMPLEMENTED();
+        result = Result::ErrorUnknown;
     }
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::FastDepthStExpClear)].pBuffer != nullptr))
+    for (uint32 idx = 0; (result == Result::Success) && (idx < uint32(RpmComputePipeline::Count)); idx++)
     {
-        constexpr uint32 Index = uint32(RpmComputePipeline::FastDepthStExpClear);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
+        if (pTable[idx].pBuffer != nullptr)
+        {
+            AbiReader abiReader(pDevice->GetPlatform(), {pTable[idx].pBuffer, pTable[idx].size});
+            result = abiReader.Init();
+        }
     }
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::FillMem4xDword)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::FillMem4xDword);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
+    return result;
+}
 
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
+// =====================================================================================================================
+// Creates all compute pipeline objects required by RsrcProcMgr.
+Result CreateRpmComputePipelines(
+    GfxDevice*        pDevice,
+    ComputePipeline** pPipelineMem)
+{
+    Result result = Result::Success;
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::FillMemDword)].pBuffer != nullptr))
+    for (uint32 idx = 0; (result == Result::Success) && (idx < uint32(RpmComputePipeline::Count)); idx++)
     {
-        constexpr uint32 Index = uint32(RpmComputePipeline::FillMemDword);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
+        result = CreateRpmComputePipeline(pDevice, RpmComputePipeline(idx), &pPipelineMem[idx]);
     }
 
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::GenerateMipmaps)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::GenerateMipmaps);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::GenerateMipmapsLowp)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::GenerateMipmapsLowp);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::HtileCopyAndFixUp)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::HtileCopyAndFixUp);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::HtileSR4xUpdate)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::HtileSR4xUpdate);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::HtileSRUpdate)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::HtileSRUpdate);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskCopyImage)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskCopyImage);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskCopyImageOptimized)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskCopyImageOptimized);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskCopyImgToMem)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskCopyImgToMem);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskExpand2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskExpand2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskExpand4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskExpand4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskExpand8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskExpand8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve1xEqaa)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve1xEqaa);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaa)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaa);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaaMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaaMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaaMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2xEqaaMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve2xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve2xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaa)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaa);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaaMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaaMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaaMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4xEqaaMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve4xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve4xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaa)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaa);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaaMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaaMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaaMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8xEqaaMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskResolve8xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskResolve8xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaFmaskScaledCopy)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaFmaskScaledCopy);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve2xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve2xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve2xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve2xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve4xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve4xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve4xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve4xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve8xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve8xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolve8xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolve8xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil2xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil2xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil2xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil2xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil4xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil4xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil4xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil4xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil8xMax)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil8xMax);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaResolveStencil8xMin)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaResolveStencil8xMin);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::MsaaScaledCopyImage2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::MsaaScaledCopyImage2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ResolveOcclusionQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ResolveOcclusionQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ResolvePipelineStatsQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ResolvePipelineStatsQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ResolveStreamoutStatsQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ResolveStreamoutStatsQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::RgbToYuvPacked)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::RgbToYuvPacked);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::RgbToYuvPlanar)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::RgbToYuvPlanar);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyImage2d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyImage2d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyImage2dMorton2x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyImage2dMorton2x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyImage2dMorton4x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyImage2dMorton4x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyImage2dMorton8x)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyImage2dMorton8x);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyImage3d)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyImage3d);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::ScaledCopyTypedBufferToImg2D)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::ScaledCopyTypedBufferToImg2D);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::YuvIntToRgb)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::YuvIntToRgb);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::YuvToRgb)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::YuvToRgb);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx9EchoGlobalTable)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx9EchoGlobalTable);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10BuildDccLookupTable)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10BuildDccLookupTable);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10ClearDccComputeSetFirstPixel)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10ClearDccComputeSetFirstPixel);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10ClearDccComputeSetFirstPixelMsaa)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10ClearDccComputeSetFirstPixelMsaa);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10GenerateCmdDispatch)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10GenerateCmdDispatch);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10GenerateCmdDispatchTaskMesh)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10GenerateCmdDispatchTaskMesh);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10GenerateCmdDraw)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10GenerateCmdDraw);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10GfxDccToDisplayDcc)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10GfxDccToDisplayDcc);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10PrtPlusResolveResidencyMapDecode)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10PrtPlusResolveResidencyMapDecode);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10PrtPlusResolveResidencyMapEncode)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10PrtPlusResolveResidencyMapEncode);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10PrtPlusResolveSamplingStatusMap)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10PrtPlusResolveSamplingStatusMap);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx10VrsHtile)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx10VrsHtile);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx11GenerateCmdDispatchTaskMesh)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx11GenerateCmdDispatchTaskMesh);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12EchoGlobalTable)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12EchoGlobalTable);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12FillMem128b)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12FillMem128b);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12FillMem128bNoalloc)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12FillMem128bNoalloc);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        pipeInfo.interleaveSize = DispatchInterleaveSize::Disable;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12ResolveOcclusionQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12ResolveOcclusionQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12ResolvePipelineStatsQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12ResolvePipelineStatsQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
-#if PAL_BUILD_GFX12&& ((0 && 0) || (PAL_BUILD_NAVI48&& 0)  || PAL_BUILD_NAVI48)
-    if ((result == Result::Success) && (pTable[uint32(RpmComputePipeline::Gfx12ResolveStreamoutStatsQuery)].pBuffer != nullptr))
-    {
-        constexpr uint32 Index = uint32(RpmComputePipeline::Gfx12ResolveStreamoutStatsQuery);
-
-        ComputePipelineCreateInfo pipeInfo = { };
-        pipeInfo.pPipelineBinary           = pTable[Index].pBuffer;
-        pipeInfo.pipelineBinarySize        = pTable[Index].size;
-
-        result = pDevice->CreateComputePipelineInternal(pipeInfo, &pPipelineMem[Index], AllocInternal);
-    }
-#endif
-
     return result;
 }
 
@@ -171,6 +171,8 @@ enum class RpmComputePipeline : uint32
     Count
 };
 
+Result CreateRpmComputePipeline(GfxDevice* pDevice, RpmComputePipeline pipeline, ComputePipeline** ppPipeline);
 Result CreateRpmComputePipelines(GfxDevice* pDevice, ComputePipeline** pPipelineMem);
+Result ValidateRpmComputePipelines(GfxDevice* pDevice);
 
 } // Pal
@@ -81,6 +81,8 @@ RsrcProcMgr::RsrcProcMgr(
     memset(&m_pMsaaState[0], 0, sizeof(m_pMsaaState));
     memset(&m_pComputePipelines[0], 0, sizeof(m_pComputePipelines));
     memset(&m_pGraphicsPipelines[0], 0, sizeof(m_pGraphicsPipelines));
+
+    MarkComputePipelinesReady(false);
 }
 
 // =====================================================================================================================
@@ -123,6 +125,9 @@ RsrcProcMgr::~RsrcProcMgr()
 // this object.
 void RsrcProcMgr::Cleanup()
 {
+    // The prewarm thread may still be creating pipelines.
+    m_prewarmThread.Join();
+
     // Destroy all compute pipeline objects.
     for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
     {
@@ -133,6 +138,8 @@ void RsrcProcMgr::Cleanup()
         }
     }
 
+    MarkComputePipelinesReady(false);
+
     // Destroy all graphics pipeline objects.
     for (uint32 idx = 0; idx < RpmGfxPipelineCount; ++idx)
     {
@@ -201,9 +208,34 @@ Result RsrcProcMgr::LateInit()
 {
     Result result = Result::Success;
 
-    if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager == false)
+    const PalSettings& settings = m_pDevice->Parent()->Settings();
+
+    if (m_pDevice->Parent()->GetPublicSettings()->disableResourceProcessingManager)
+    {
+        // No RPM pipelines may be created, so GetPipeline() must never try to.
+        MarkComputePipelinesReady(true);
+    }
+    else
     {
-        result = CreateRpmComputePipelines(m_pDevice, m_pComputePipelines);
+        if (settings.rpmLazyComputePipelines)
+        {
+            // Catch missing or malformed binaries now, while the failure can still be reported.
+            result = ValidateRpmComputePipelines(m_pDevice);
+
+            if (result == Result::Success)
+            {
+                result = CreateNonLazyComputePipelines();
+            }
+        }
+        else
+        {
+            result = CreateRpmComputePipelines(m_pDevice, m_pComputePipelines);
+
+            if (result == Result::Success)
+            {
+                MarkComputePipelinesReady(true);
+            }
+        }
 
         if (result == Result::Success)
         {
@@ -215,11 +247,166 @@ Result RsrcProcMgr::LateInit()
             result = CreateCommonStateObjects();
         }
 
+        // Failing to start the prewarm thread is harmless: the pipelines will be created on first use instead.
+        if ((result == Result::Success) && settings.rpmLazyComputePipelines && settings.rpmPrewarmComputePipelines)
+        {
+            m_prewarmThread.Begin(&PrewarmComputePipelines, this);
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Sets the ready flag of every compute pipeline. This must not be called while other threads may call GetPipeline().
+void RsrcProcMgr::MarkComputePipelinesReady(
+    bool ready)
+{
+    for (uint32 idx = 0; idx < static_cast<uint32>(RpmComputePipeline::Count); ++idx)
+    {
+        m_computePipelineReady[idx].store(ready, std::memory_order_release);
+    }
+}
+
+// =====================================================================================================================
+// Compute pipelines which are created on first use when rpmLazyComputePipelines is set. Creating a pipeline on first
+// use can run out of memory while a command buffer is being recorded, so a pipeline may only be listed here if every
+// caller of GetPipeline() for it checks for null, reports the failure on the command buffer and skips its work.
+constexpr RpmComputePipeline LazyComputePipelines[] =
+{
+    RpmComputePipeline::CopyImgToMem1d,
+    RpmComputePipeline::CopyImgToMem2d,
+    RpmComputePipeline::CopyImgToMem2dms2x,
+    RpmComputePipeline::CopyImgToMem2dms4x,
+    RpmComputePipeline::CopyImgToMem2dms8x,
+    RpmComputePipeline::CopyImgToMem3d,
+    RpmComputePipeline::CopyMemToImg1d,
+    RpmComputePipeline::CopyMemToImg2d,
+    RpmComputePipeline::CopyMemToImg2dms2x,
+    RpmComputePipeline::CopyMemToImg2dms4x,
+    RpmComputePipeline::CopyMemToImg2dms8x,
+    RpmComputePipeline::CopyMemToImg3d,
+    RpmComputePipeline::MsaaFmaskCopyImgToMem,
+    RpmComputePipeline::MsaaFmaskResolve1xEqaa,
+    RpmComputePipeline::MsaaFmaskResolve2x,
+    RpmComputePipeline::MsaaFmaskResolve2xEqaa,
+    RpmComputePipeline::MsaaFmaskResolve2xEqaaMax,
+    RpmComputePipeline::MsaaFmaskResolve2xEqaaMin,
+    RpmComputePipeline::MsaaFmaskResolve2xMax,
+    RpmComputePipeline::MsaaFmaskResolve2xMin,
+    RpmComputePipeline::MsaaFmaskResolve4x,
+    RpmComputePipeline::MsaaFmaskResolve4xEqaa,
+    RpmComputePipeline::MsaaFmaskResolve4xEqaaMax,
+    RpmComputePipeline::MsaaFmaskResolve4xEqaaMin,
+    RpmComputePipeline::MsaaFmaskResolve4xMax,
+    RpmComputePipeline::MsaaFmaskResolve4xMin,
+    RpmComputePipeline::MsaaFmaskResolve8x,
+    RpmComputePipeline::MsaaFmaskResolve8xEqaa,
+    RpmComputePipeline::MsaaFmaskResolve8xEqaaMax,
+    RpmComputePipeline::MsaaFmaskResolve8xEqaaMin,
+    RpmComputePipeline::MsaaFmaskResolve8xMax,
+    RpmComputePipeline::MsaaFmaskResolve8xMin,
+    RpmComputePipeline::MsaaResolve2x,
+    RpmComputePipeline::MsaaResolve2xMax,
+    RpmComputePipeline::MsaaResolve2xMin,
+    RpmComputePipeline::MsaaResolve4x,
+    RpmComputePipeline::MsaaResolve4xMax,
+    RpmComputePipeline::MsaaResolve4xMin,
+    RpmComputePipeline::MsaaResolve8x,
+    RpmComputePipeline::MsaaResolve8xMax,
+    RpmComputePipeline::MsaaResolve8xMin,
+    RpmComputePipeline::MsaaResolveStencil2xMax,
+    RpmComputePipeline::MsaaResolveStencil2xMin,
+    RpmComputePipeline::MsaaResolveStencil4xMax,
+    RpmComputePipeline::MsaaResolveStencil4xMin,
+    RpmComputePipeline::MsaaResolveStencil8xMax,
+    RpmComputePipeline::MsaaResolveStencil8xMin,
+};
+
+// =====================================================================================================================
+// Creates every compute pipeline which is not in LazyComputePipelines, as LateInit() would without
+// rpmLazyComputePipelines. The lazy pipelines are left to be created on first use.
+Result RsrcProcMgr::CreateNonLazyComputePipelines()
+{
+    Result result = Result::Success;
+
+    bool isLazy[static_cast<size_t>(RpmComputePipeline::Count)] = {};
+
+    for (RpmComputePipeline pipeline : LazyComputePipelines)
+    {
+        isLazy[static_cast<size_t>(pipeline)] = true;
+    }
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < static_cast<uint32>(RpmComputePipeline::Count)); ++idx)
+    {
+        if (isLazy[idx] == false)
+        {
+            result = CreateRpmComputePipeline(m_pDevice, RpmComputePipeline(idx), &m_pComputePipelines[idx]);
+
+            if (result == Result::Success)
+            {
+                m_computePipelineReady[idx].store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Slow path of GetPipeline(): creates a compute pipeline the first time it is requested. Other threads requesting the
+// same pipeline wait for the first one to finish creating it.
+const ComputePipeline* RsrcProcMgr::CreatePipelineOnDemand(
+    RpmComputePipeline pipeline
+    ) const
+{
+    const uint32 index = static_cast<uint32>(pipeline);
+
+    MutexAuto lock(&m_computePipelineLock);
+
+    if (m_computePipelineReady[index].load(std::memory_order_relaxed) == false)
+    {
+        // Only pipelines in LazyComputePipelines get here. LateInit() validated every binary, so creation can only fail
+        // if we ran out of memory. The slot is left not ready in that case so that the next request retries instead of
+        // caching a null pipeline; the caller reports the failure on its command buffer.
+        if (CreateRpmComputePipeline(m_pDevice, pipeline, &m_pComputePipelines[index]) == Result::Success)
+        {
+            m_computePipelineReady[index].store(true, std::memory_order_release);
+        }
+        else
+        {
+            m_pComputePipelines[index] = nullptr;
+        }
+    }
+
+    return m_pComputePipelines[index];
+}
+
+// =====================================================================================================================
+// The lazily created compute pipelines which most workloads use (2D image uploads and readbacks and basic MSAA
+// resolves). These are created by the prewarm thread when rpmPrewarmComputePipelines is set.
+constexpr RpmComputePipeline HotComputePipelines[] =
+{
+    RpmComputePipeline::CopyImgToMem2d,
+    RpmComputePipeline::CopyMemToImg2d,
+    RpmComputePipeline::MsaaResolve2x,
+    RpmComputePipeline::MsaaResolve4x,
+    RpmComputePipeline::MsaaResolve8x,
+};
+
+// =====================================================================================================================
+// Entry point of the prewarm thread started by LateInit().
+void RsrcProcMgr::PrewarmComputePipelines(
+    void* pParameter)
+{
+    const RsrcProcMgr* pRsrcProcMgr = static_cast<const RsrcProcMgr*>(pParameter);
+
+    for (RpmComputePipeline pipeline : HotComputePipelines)
+    {
+        pRsrcProcMgr->GetPipeline(pipeline);
+    }
+}
+
 // =====================================================================================================================
 // Builds commands to copy one or more regions from one GPU memory location to another with a compute shader.
 void RsrcProcMgr::CopyMemoryCs(
@@ -1071,7 +1258,9 @@ void RsrcProcMgr::CmdCopyMemoryToImage(
     // Note that we must call this helper function before and after our compute blit to fix up our image's metadata
     // if the copy isn't compatible with our layout's metadata compression level.
     AutoBuffer<ImageFixupRegion, 32, Platform> fixupRegions(regionCount, m_pDevice->GetPlatform());
-    if (fixupRegions.Capacity() >= regionCount)
+
+    // The pipeline is null if creating it on first use ran out of memory.
+    if ((pPipeline != nullptr) && (fixupRegions.Capacity() >= regionCount))
     {
         for (uint32 i = 0; i < regionCount; i++)
         {
@@ -1162,16 +1351,24 @@ void RsrcProcMgr::CmdCopyImageToMemory(
         break;
     }
 
-    CopyBetweenMemoryAndImage(pCmdBuffer,
-                              pPipeline,
-                              dstGpuMemory,
-                              srcImage,
-                              srcImageLayout,
-                              false,
-                              isFmaskCopy,
-                              regionCount,
-                              pRegions,
-                              includePadding);
+    // The pipeline is null if creating it on first use ran out of memory.
+    if (pPipeline != nullptr)
+    {
+        CopyBetweenMemoryAndImage(pCmdBuffer,
+                                  pPipeline,
+                                  dstGpuMemory,
+                                  srcImage,
+                                  srcImageLayout,
+                                  false,
+                                  isFmaskCopy,
+                                  regionCount,
+                                  pRegions,
+                                  includePadding);
+    }
+    else
+    {
+        pCmdBuffer->NotifyAllocFailure();
+    }
 }
 
 // =====================================================================================================================
@@ -4382,6 +4579,13 @@ void RsrcProcMgr::ResolveImageCompute(
                                                                      resolveMode,
                                                                      method);
 
+        if (pPipeline == nullptr)
+        {
+            // Creating the pipeline on first use ran out of memory. Skip this region but still restore the state.
+            pCmdBuffer->NotifyAllocFailure();
+            continue;
+        }
+
         const DispatchDims threadsPerGroup = pPipeline->ThreadsPerGroupXyz();
 
         // Bind the pipeline.
@@ -4753,7 +4957,7 @@ const ComputePipeline* RsrcProcMgr::GetCsResolvePipeline(
         }
     }
 
-    PAL_ASSERT(pPipeline != nullptr);
+    // This can be null if creating the pipeline on first use ran out of memory, so the caller must check.
     return pPipeline;
 }
 
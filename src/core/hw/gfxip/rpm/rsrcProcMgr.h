@@ -28,6 +28,10 @@
 #include "core/hw/gfxip/rpm/g_rpmComputePipelineInit.h"
 #include "core/hw/gfxip/rpm/g_rpmGfxPipelineInit.h"
 #include "palCmdBuffer.h"
+#include "palMutex.h"
+#include "palThread.h"
+
+#include <atomic>
 
 namespace Pal
 {
@@ -436,8 +440,15 @@ protected:
         const Pal::Image& dstImage) const
         { return false; }
 
+    // Returns the requested compute pipeline, creating it first if this is its first use. Returns null if the pipeline
+    // is not supported on this device. Only the pipelines in LazyComputePipelines are created on first use, and for
+    // those it also returns null if that ran out of memory; their callers must check for this.
     const ComputePipeline* GetPipeline(RpmComputePipeline pipeline) const
-        { return m_pComputePipelines[static_cast<size_t>(pipeline)]; }
+    {
+        const size_t index = static_cast<size_t>(pipeline);
+        return m_computePipelineReady[index].load(std::memory_order_acquire) ? m_pComputePipelines[index]
+                                                                             : CreatePipelineOnDemand(pipeline);
+    }
 
     const GraphicsPipeline* GetGfxPipeline(RpmGfxPipeline pipeline) const
         { return m_pGraphicsPipelines[pipeline]; }
@@ -801,11 +812,22 @@ private:
         GfxCmdBuffer*         pCmdBuffer,
         const GenMipmapsInfo& genInfo) const;
 
+    Result CreateNonLazyComputePipelines();
+    const ComputePipeline* CreatePipelineOnDemand(RpmComputePipeline pipeline) const;
+    void MarkComputePipelinesReady(bool ready);
+
+    static void PrewarmComputePipelines(void* pParameter);
+
     uint32             m_srdAlignment;  // All SRDs must be offset and size aligned to this many DWORDs.
 
-    // All internal RPM pipelines are stored here.
-    ComputePipeline*   m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
-    GraphicsPipeline*  m_pGraphicsPipelines[RpmGfxPipelineCount];
+    // All internal RPM pipelines are stored here. Compute pipelines may be created on first use by GetPipeline(), so
+    // each entry is only valid once its ready flag has been set. m_computePipelineLock serializes their creation.
+    mutable ComputePipeline*  m_pComputePipelines[static_cast<size_t>(RpmComputePipeline::Count)];
+    mutable std::atomic<bool> m_computePipelineReady[static_cast<size_t>(RpmComputePipeline::Count)];
+    mutable Util::Mutex       m_computePipelineLock;
+    GraphicsPipeline*         m_pGraphicsPipelines[RpmGfxPipelineCount];
+
+    Util::Thread              m_prewarmThread; // Creates commonly used compute pipelines in the background.
 
     PAL_DISALLOW_DEFAULT_CTOR(RsrcProcMgr);
     PAL_DISALLOW_COPY_AND_ASSIGN(RsrcProcMgr);
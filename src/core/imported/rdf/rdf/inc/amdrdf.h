@@ -45,7 +45,7 @@
      (static_cast<std::uint32_t>(minor) << 12) | \
      (static_cast<std::uint32_t>(patch)))
 
-#define RDF_INTERFACE_VERSION RDF_MAKE_VERSION(1, 4, 0)
+#define RDF_INTERFACE_VERSION RDF_MAKE_VERSION(1, 6, 0)
 
 extern "C" {
 struct rdfChunkFile;
@@ -193,6 +193,16 @@ int RDF_EXPORT rdfStreamFromFile(const rdfStreamFromFileCreateInfo* info, rdfStr
 
 int RDF_EXPORT rdfStreamOpenFile(const char* filename, rdfStream** stream);
 int RDF_EXPORT rdfStreamCreateFile(const char* filename, rdfStream** stream);
+
+/**
+ * @brief Open a file for reading through a read-only memory mapping
+ *
+ * Chunk files opened from a mapped stream support zero-copy access to
+ * uncompressed chunks through `rdfChunkFileGetChunkDataPointer`.
+ *
+ * @since 1.5
+ */
+int RDF_EXPORT rdfStreamOpenMappedFile(const char* filename, rdfStream** stream);
 int RDF_EXPORT rdfStreamFromReadOnlyMemory(const std::int64_t size,
                                            const void* buffer,
                                            rdfStream** stream);
@@ -241,6 +251,19 @@ int RDF_EXPORT rdfChunkFileReadChunkData(rdfChunkFile* handle,
                                          const int chunkIndex,
                                          void* buffer);
 
+/**
+ * @brief Get a pointer to the data of a chunk without copying it
+ *
+ * `data` is set to `null` if the chunk file is not backed by a mapped stream
+ * or the chunk is compressed, use `rdfChunkFileReadChunkData` in that case.
+ *
+ * @since 1.5
+ */
+int RDF_EXPORT rdfChunkFileGetChunkDataPointer(rdfChunkFile* handle,
+                                               const char* chunkId,
+                                               const int chunkIndex,
+                                               const void** data);
+
 int RDF_EXPORT rdfChunkFileGetChunkHeaderSize(rdfChunkFile* handle,
                                               const char* chunkId,
                                               const int chunkIndex,
@@ -301,6 +324,46 @@ int RDF_EXPORT rdfChunkFileWriterWriteChunk(rdfChunkFileWriter* writer,
                                             const void* data,
                                             int* index);
 
+/**
+ * @brief Get an upper bound for the size of `size` bytes of chunk data after compression
+ *
+ * @since 1.6
+ */
+int RDF_EXPORT rdfGetCompressedChunkDataBound(const rdfCompression compression,
+                                              const std::int64_t size,
+                                              std::int64_t* bound);
+
+/**
+ * @brief Compress chunk data without a writer
+ *
+ * The result can be written with `rdfChunkFileWriterWriteCompressedChunk`. This
+ * lets several threads compress chunks concurrently while appending them to a
+ * single writer one at a time. `bufferSize` should be at least the bound
+ * returned by `rdfGetCompressedChunkDataBound`.
+ *
+ * @since 1.6
+ */
+int RDF_EXPORT rdfCompressChunkData(const rdfCompression compression,
+                                    const std::int64_t size,
+                                    const void* data,
+                                    const std::int64_t bufferSize,
+                                    void* buffer,
+                                    std::int64_t* compressedSize);
+
+/**
+ * @brief Write a chunk whose data was compressed with `rdfCompressChunkData`
+ *
+ * `info->compression` must match the compression the data was compressed with.
+ *
+ * @since 1.6
+ */
+int RDF_EXPORT rdfChunkFileWriterWriteCompressedChunk(rdfChunkFileWriter* writer,
+                                                      const rdfChunkCreateInfo* info,
+                                                      const std::int64_t compressedSize,
+                                                      const void* compressedData,
+                                                      const std::int64_t uncompressedSize,
+                                                      int* index);
+
 int RDF_EXPORT rdfResultToString(rdfResult result, const char** output);
 }
 
@@ -364,6 +427,13 @@ public:
         return result;
     }
 
+    static Stream OpenMappedFile(const char* filename)
+    {
+        Stream result;
+        RDF_CHECK_CALL(rdfStreamOpenMappedFile(filename, &result.stream_));
+        return result;
+    }
+
     static Stream CreateFile(const char* filename)
     {
         Stream result;
@@ -651,6 +721,18 @@ public:
         ReadChunkDataToBuffer(chunkId, 0, buffer);
     }
 
+    const void* GetChunkDataPointer(const char* chunkId) const
+    {
+        return GetChunkDataPointer(chunkId, 0);
+    }
+
+    const void* GetChunkDataPointer(const char* chunkId, const int chunkIndex) const
+    {
+        const void* data = nullptr;
+        RDF_CHECK_CALL(rdfChunkFileGetChunkDataPointer(chunkFile_, chunkId, chunkIndex, &data));
+        return data;
+    }
+
     std::int64_t GetChunkHeaderSize(const char* chunkId) const
     {
         return GetChunkHeaderSize(chunkId, 0);
@@ -49,7 +49,10 @@
 #include <vector>
 
 #if RDF_PLATFORM_UNIX
+    #include <fcntl.h>
+    #include <sys/mman.h>
     #include <sys/stat.h>
+    #include <unistd.h>
 #endif
 
 namespace rdf
@@ -105,6 +108,13 @@ namespace internal
         bool CanWrite() const;
         bool CanRead() const;
 
+        /**
+        Get a pointer to the whole stream contents if the stream is backed by
+        a contiguous, immutable memory range (for example, a mapped file.)
+        Returns nullptr otherwise.
+        */
+        const void* GetMappedData() const;
+
         void Close();
 
     private:
@@ -120,6 +130,11 @@ namespace internal
         virtual bool CanWriteImpl() const = 0;
         virtual bool CanReadImpl() const = 0;
 
+        virtual const void* GetMappedDataImpl() const
+        {
+            return nullptr;
+        }
+
         virtual void CloseImpl() = 0;
     };
 
@@ -285,6 +300,8 @@ namespace internal
 
     std::unique_ptr<IStream> CreateFile(const char* filename);
 
+    std::unique_ptr<IStream> OpenMappedFile(const char* filename);
+
     std::unique_ptr<IStream> CreateReadOnlyMemoryStream(const std::int64_t bufferSize,
                                                         const void* buffer);
 
@@ -381,6 +398,8 @@ namespace internal
                 throw std::runtime_error("Unsupported file version");
             }
 
+            streamSize_ = stream_->GetSize();
+
             index_.resize(header_.indexSize / sizeof(IndexEntry));
             stream_->Read(header_.indexOffset,
                           index_.size() * sizeof(IndexEntry),
@@ -448,6 +467,7 @@ namespace internal
 
             assert(entry.chunkHeaderOffset >= 0);
             assert(entry.chunkHeaderSize >= 0);
+            CheckEntryRange(entry.chunkHeaderOffset, entry.chunkHeaderSize);
             if (entry.chunkHeaderSize > 0) {
                 // TODO Check error?
                 stream_->Read(entry.chunkHeaderOffset, entry.chunkHeaderSize, buffer);
@@ -460,8 +480,19 @@ namespace internal
 
             assert(entry.chunkDataOffset >= 0);
             assert(entry.chunkDataSize >= 0);
+            CheckEntryRange(entry.chunkDataOffset, entry.chunkDataSize);
 
-            if (entry.compression == Compression::Zstd) {
+            const auto mappedData = static_cast<const unsigned char*>(stream_->GetMappedData());
+
+            if ((entry.compression == Compression::Zstd) && (mappedData != nullptr)) {
+                // Decompress straight out of the mapping, there's no need to
+                // stage the compressed bytes in a temporary buffer
+                assert(entry.uncompressedChunkSize >= 0);
+                ZSTD_decompress(buffer,
+                                entry.uncompressedChunkSize,
+                                mappedData + entry.chunkDataOffset,
+                                entry.chunkDataSize);
+            } else if (entry.compression == Compression::Zstd) {
                 std::vector<unsigned char> compressedData;
                 compressedData.resize(entry.chunkDataSize);
 
@@ -501,7 +532,40 @@ namespace internal
             return GetChunkInfo(chunkId, index).chunkHeaderSize;
         }
 
+        /**
+        Get a pointer to the chunk data inside the underlying stream.
+
+        This is only possible if the stream is memory-mapped and the chunk is
+        stored uncompressed; in all other cases, nullptr is returned and the
+        data has to be read using ReadChunkData(). The pointer remains valid
+        as long as the stream is open.
+        */
+        const void* GetChunkDataPointer(const char* chunkId, const int index) const
+        {
+            const auto& entry = GetChunkInfo(chunkId, index);
+            const auto mappedData = static_cast<const unsigned char*>(stream_->GetMappedData());
+
+            if ((mappedData == nullptr) || (entry.compression != Compression::None)) {
+                return nullptr;
+            }
+
+            CheckEntryRange(entry.chunkDataOffset, entry.chunkDataSize);
+
+            return mappedData + entry.chunkDataOffset;
+        }
+
     private:
+        void CheckEntryRange(const std::int64_t offset, const std::int64_t size) const
+        {
+            // Only needed for mapped streams -- all other streams clamp reads
+            // to their size, but we must never hand out a pointer past the
+            // end of a mapping
+            if ((stream_->GetMappedData() != nullptr) &&
+                ((offset < 0) || (size < 0) || (offset > streamSize_ - size))) {
+                throw std::runtime_error("Chunk range is out of bounds");
+            }
+        }
+
         void BuildChunkIndex()
         {
             // We stable-sort this by index name. This allows us to index
@@ -538,6 +602,7 @@ namespace internal
 
         Header header_;
         std::vector<IndexEntry> index_;
+        std::int64_t streamSize_ = 0;
 
         struct Range
         {
@@ -714,21 +779,7 @@ namespace internal
                 assert(currentChunk_->chunkDataSize >= 0);
             }
 
-            ChunkId id(currentChunk_->chunkIdentifier);
-
-            int index = 0;
-            if (chunkCountPerType_.find(id) != chunkCountPerType_.end()) {
-                auto entry = chunkCountPerType_.find(id);
-                index = entry->second;
-                ++entry->second;
-            } else {
-                chunkCountPerType_[id] = 1;
-            }
-
-            currentChunk_ = nullptr;
-            chunkDataBuffer_.clear();
-
-            return index;
+            return FinishChunk();
         }
 
         int WriteChunk(const char* chunkIdentifier,
@@ -744,6 +795,36 @@ namespace internal
             return EndChunk();
         }
 
+        /**
+        Write a chunk whose data was compressed up front, see CompressChunkData.
+        */
+        int WriteCompressedChunk(const char* chunkIdentifier,
+                                 const std::int64_t chunkHeaderSize,
+                                 const void* chunkHeader,
+                                 const std::int64_t compressedDataSize,
+                                 const void* compressedData,
+                                 const std::int64_t uncompressedDataSize,
+                                 const Compression compression,
+                                 const std::uint32_t version)
+        {
+            if (compression == Compression::None) {
+                throw std::runtime_error("Precompressed chunks must specify a compression");
+            }
+
+            BeginChunk(chunkIdentifier, chunkHeaderSize, chunkHeader, compression, version);
+
+            if (stream_->Write(dataWriteOffset_, compressedDataSize, compressedData) != compressedDataSize) {
+                throw std::runtime_error("Error while writing to file.");
+            }
+
+            dataWriteOffset_ += compressedDataSize;
+
+            currentChunk_->chunkDataSize = compressedDataSize;
+            currentChunk_->uncompressedChunkSize = uncompressedDataSize;
+
+            return FinishChunk();
+        }
+
         /**
         Flush all pending data and finalize the file.
 
@@ -765,6 +846,25 @@ namespace internal
         }
 
     private:
+        int FinishChunk()
+        {
+            ChunkId id(currentChunk_->chunkIdentifier);
+
+            int index = 0;
+            if (chunkCountPerType_.find(id) != chunkCountPerType_.end()) {
+                auto entry = chunkCountPerType_.find(id);
+                index = entry->second;
+                ++entry->second;
+            } else {
+                chunkCountPerType_[id] = 1;
+            }
+
+            currentChunk_ = nullptr;
+            chunkDataBuffer_.clear();
+
+            return index;
+        }
+
         void Construct(bool append)
         {
             if (!stream_->CanWrite()) {
@@ -875,6 +975,12 @@ namespace internal
         CloseImpl();
     }
 
+    //////////////////////////////////////////////////////////////////////
+    const void* IStream::GetMappedData() const
+    {
+        return GetMappedDataImpl();
+    }
+
     //////////////////////////////////////////////////////////////////////
     bool IStream::CanRead() const
     {
@@ -1079,6 +1185,185 @@ namespace internal
         std::vector<unsigned char> data_;
     };
 
+    //////////////////////////////////////////////////////////////////////
+    /**
+    Read-only stream backed by a file mapping.
+
+    Reads are plain copies out of the mapping, and GetMappedData() exposes the
+    mapping so the chunk file can hand out pointers to uncompressed chunk data
+    and decompress without staging the compressed bytes. Pages are only
+    faulted in when touched, so opening a multi-GiB file and accessing a
+    single chunk only reads that chunk (and the index) from disk.
+
+    Limited to 4 GiB on 32-bit platforms.
+    */
+    class MappedFileStream final : public IStream
+    {
+    public:
+        explicit MappedFileStream(const char* filename)
+        {
+#if RDF_PLATFORM_WINDOWS
+            file_ = ::CreateFileA(filename,
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  NULL,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+                                  NULL);
+            if (file_ == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Could not open file");
+            }
+
+            // Disable inheritance of the file handle.
+            SetHandleInformation(file_, HANDLE_FLAG_INHERIT, 0);
+
+            LARGE_INTEGER fileSize = {};
+            if (GetFileSizeEx(file_, &fileSize) == FALSE) {
+                CloseImpl();
+                throw std::runtime_error("Could not query file size");
+            }
+            size_ = fileSize.QuadPart;
+
+            if (size_ > 0) {
+                mapping_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (mapping_ != NULL) {
+                    data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+                }
+
+                if (data_ == nullptr) {
+                    CloseImpl();
+                    throw std::runtime_error("Could not map file");
+                }
+            }
+#elif RDF_PLATFORM_UNIX
+            const int fd = ::open(filename, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                throw std::runtime_error("Could not open file");
+            }
+
+            struct stat statBuffer;
+            if (fstat(fd, &statBuffer) != 0) {
+                ::close(fd);
+                throw std::runtime_error("Could not query file size");
+            }
+            size_ = statBuffer.st_size;
+
+            if (size_ > 0) {
+                if (CheckIsInSystemSizeRange(size_) == false) {
+                    ::close(fd);
+                    throw std::runtime_error("File is too large to be mapped");
+                }
+
+                void* data = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("Could not map file");
+                }
+
+                // Chunk access is driven by the index, so don't let the kernel
+                // read ahead linearly through data nobody asked for
+                madvise(data, static_cast<size_t>(size_), MADV_RANDOM);
+                data_ = data;
+            }
+
+            // The mapping keeps its own reference to the file
+            ::close(fd);
+#else
+#error "Unsupported platform"
+#endif
+        }
+
+        ~MappedFileStream() override
+        {
+            CloseImpl();
+        }
+
+    private:
+        std::int64_t ReadImpl(const std::int64_t offset,
+            const std::int64_t count, void* buffer) override
+        {
+            if (offset > size_) {
+                throw std::runtime_error("Read offset is out of bounds");
+            }
+
+            auto bytesToRead = std::max(std::int64_t(0),
+                std::min(size_ - offset, count));
+            if (bytesToRead > 0) {
+                ::memcpy(buffer,
+                    static_cast<const unsigned char*>(data_) + offset,
+                    bytesToRead);
+            }
+
+            return bytesToRead;
+        }
+
+        std::int64_t WriteImpl(const std::int64_t offset,
+            const std::int64_t count, const void* buffer) override
+        {
+            assert(false);
+            return 0;
+        }
+
+        std::int64_t GetSizeImpl() const override
+        {
+            return size_;
+        }
+
+        bool CanWriteImpl() const override
+        {
+            return false;
+        }
+
+        bool CanReadImpl() const override
+        {
+            return true;
+        }
+
+        const void* GetMappedDataImpl() const override
+        {
+            return data_;
+        }
+
+        void CloseImpl() override
+        {
+#if RDF_PLATFORM_WINDOWS
+            if (data_ != nullptr) {
+                UnmapViewOfFile(data_);
+            }
+
+            if (mapping_ != NULL) {
+                CloseHandle(mapping_);
+                mapping_ = NULL;
+            }
+
+            if (file_ != INVALID_HANDLE_VALUE) {
+                CloseHandle(file_);
+                file_ = INVALID_HANDLE_VALUE;
+            }
+#elif RDF_PLATFORM_UNIX
+            if (data_ != nullptr) {
+                munmap(const_cast<void*>(data_), static_cast<size_t>(size_));
+            }
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        const void* data_ = nullptr;
+        std::int64_t size_ = 0;
+
+#if RDF_PLATFORM_WINDOWS
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = NULL;
+#endif
+    };
+
+    //////////////////////////////////////////////////////////////////////
+    std::unique_ptr<IStream> OpenMappedFile(const char* filename)
+    {
+        return rdf_make_unique<MappedFileStream>(filename);
+    }
+
     //////////////////////////////////////////////////////////////////////
     std::unique_ptr<IStream> CreateReadOnlyMemoryStream(const std::int64_t size, const void* buffer)
     {
@@ -1356,6 +1641,40 @@ int RDF_EXPORT rdfStreamCreateFile(const char* filename, rdfStream** handle)
     RDF_C_API_END
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/**
+Open a file for reading through a read-only memory mapping.
+
+Compared to rdfStreamOpenFile, this avoids the buffered file I/O for every
+read and only pages in the parts of the file that are actually accessed. Chunk
+files opened from such a stream also support rdfChunkFileGetChunkDataPointer.
+*/
+int RDF_EXPORT rdfStreamOpenMappedFile(const char* filename, rdfStream** handle)
+{
+    RDF_C_API_BEGIN
+
+    if (filename == nullptr) {
+        return rdfResultInvalidArgument;
+    }
+
+    if (handle == nullptr) {
+        return rdfResultInvalidArgument;
+    }
+
+    *handle = new rdfStream;
+    try {
+        (*handle)->stream = rdf::internal::OpenMappedFile(filename);
+    } catch (...) {
+        delete *handle;
+        *handle = nullptr;
+        throw;
+    }
+
+    return rdfResult::rdfResultOk;
+
+    RDF_C_API_END
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /**
 Create a stream from read-only memory.
@@ -1793,6 +2112,47 @@ int RDF_EXPORT rdfChunkFileReadChunkHeader(rdfChunkFile* handle,
     RDF_C_API_END
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/**
+Get a pointer to the data of a chunk without copying it.
+
+This succeeds only if the chunk file was opened from a memory-mapped stream
+(see rdfStreamOpenMappedFile) and the chunk is stored uncompressed. If the
+data cannot be accessed directly, `data` is set to nullptr and rdfResultOk is
+returned; the caller is expected to fall back to rdfChunkFileReadChunkData.
+
+The pointer remains valid until the underlying stream is closed.
+*/
+int RDF_EXPORT rdfChunkFileGetChunkDataPointer(rdfChunkFile* handle,
+                                               const char* chunkId,
+                                               const int chunkIndex,
+                                               const void** data)
+{
+    RDF_C_API_BEGIN
+
+    if (handle == nullptr) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    if (chunkId == nullptr) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    if (chunkIndex < 0) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    if (data == nullptr) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    *data = handle->chunkFile->GetChunkDataPointer(chunkId, chunkIndex);
+
+    return rdfResult::rdfResultOk;
+
+    RDF_C_API_END
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /**
 Get the size of the chunk header.
@@ -2331,6 +2691,115 @@ int RDF_EXPORT rdfChunkFileWriterWriteChunk(rdfChunkFileWriter* writer,
     RDF_C_API_END
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/**
+Get an upper bound for the size of chunk data after compression.
+
+Use this to size the buffer passed to rdfCompressChunkData.
+*/
+int RDF_EXPORT rdfGetCompressedChunkDataBound(const rdfCompression compression,
+                                              const std::int64_t size,
+                                              std::int64_t* bound)
+{
+    RDF_C_API_BEGIN
+
+    if ((compression != rdfCompression::rdfCompressionZstd) || (size < 0) || (bound == nullptr)) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    *bound = static_cast<std::int64_t>(ZSTD_compressBound(static_cast<size_t>(size)));
+
+    return rdfResult::rdfResultOk;
+
+    RDF_C_API_END
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+Compress chunk data without a writer.
+
+This does not touch any writer state, so several threads can compress chunks
+at the same time and then add them to a shared writer one by one using
+rdfChunkFileWriterWriteCompressedChunk.
+*/
+int RDF_EXPORT rdfCompressChunkData(const rdfCompression compression,
+                                    const std::int64_t size,
+                                    const void* data,
+                                    const std::int64_t bufferSize,
+                                    void* buffer,
+                                    std::int64_t* compressedSize)
+{
+    RDF_C_API_BEGIN
+
+    if ((compression != rdfCompression::rdfCompressionZstd) || (size < 0) || (bufferSize < 0) ||
+        (compressedSize == nullptr) || ((size > 0) && (data == nullptr)) || (buffer == nullptr)) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    const auto result = ZSTD_compress(buffer,
+                                      static_cast<size_t>(bufferSize),
+                                      data,
+                                      static_cast<size_t>(size),
+                                      ZSTD_CLEVEL_DEFAULT);
+
+    if (ZSTD_isError(result)) {
+        return rdfResult::rdfResultError;
+    }
+
+    *compressedSize = static_cast<std::int64_t>(result);
+
+    return rdfResult::rdfResultOk;
+
+    RDF_C_API_END
+}
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+Write a chunk whose data was compressed with rdfCompressChunkData.
+
+info->compression must be the compression the data was compressed with, and
+uncompressedSize the size of the data before compression.
+*/
+int RDF_EXPORT rdfChunkFileWriterWriteCompressedChunk(rdfChunkFileWriter* writer,
+                                                      const rdfChunkCreateInfo* info,
+                                                      const std::int64_t compressedSize,
+                                                      const void* compressedData,
+                                                      const std::int64_t uncompressedSize,
+                                                      int* index)
+{
+    RDF_C_API_BEGIN
+
+    if (writer == nullptr) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    if ((info == nullptr) || (info->compression == rdfCompression::rdfCompressionNone)) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    if ((compressedSize < 0) || (uncompressedSize < 0)) {
+        return rdfResult::rdfResultInvalidArgument;
+    }
+
+    const auto chunkIndex =
+        writer->writer->WriteCompressedChunk(info->identifier,
+                                             info->headerSize,
+                                             info->pHeader,
+                                             compressedSize,
+                                             compressedData,
+                                             uncompressedSize,
+                                             static_cast<rdf::internal::Compression>(info->compression),
+                                             info->version == 0 ? 1 : info->version);
+
+    if (index) {
+        *index = chunkIndex;
+    }
+
+    return rdfResult::rdfResultOk;
+
+    RDF_C_API_END
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /**
 Convert a rdfResult to a human-readable string.
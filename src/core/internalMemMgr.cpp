@@ -27,7 +27,7 @@
 #include "core/device.h"
 #include "core/internalMemMgr.h"
 #include "core/platform.h"
-#include "palBuddyAllocatorImpl.h"
+#include "palBitmapBuddyAllocatorImpl.h"
 #include "palGpuMemoryBindable.h"
 #include "palListImpl.h"
 #include "palLiterals.h"
@@ -521,7 +521,9 @@ GpuMemoryPool* InternalMemMgr::GetOpenPoolAndClaimMemory(
                 }
 
                 // Create and initialize the buddy allocator
-                newPool.pBuddyAllocator = PAL_NEW(BuddyAllocator<Platform>, m_pDevice->GetPlatform(), AllocInternal)
+                newPool.pBuddyAllocator = PAL_NEW(BitmapBuddyAllocator<Platform>,
+                                                  m_pDevice->GetPlatform(),
+                                                  AllocInternal)
                                                  (m_pDevice->GetPlatform(),
                                                   nextPoolAllocationSize,
                                                   PoolMinSuballocationSize);
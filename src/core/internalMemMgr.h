@@ -26,7 +26,7 @@
 #pragma once
 
 #include "core/gpuMemory.h"
-#include "palBuddyAllocator.h"
+#include "palBitmapBuddyAllocator.h"
 #include "palList.h"
 #include "palMutex.h"
 
@@ -56,7 +56,7 @@ struct GpuMemoryPool
     VaRange                         vaRange;                // Virtual address range
     MType                           mtype;                  // The mtype of the GPU memory object.
     uint64                          pagingFenceVal;         // Paging fence value
-    Util::BuddyAllocator<Platform>* pBuddyAllocator;        // Buddy allocator used for the suballocation
+    Util::BitmapBuddyAllocator<Platform>* pBuddyAllocator;  // Buddy allocator used for the suballocation
 };
 
 struct PoolWithKval
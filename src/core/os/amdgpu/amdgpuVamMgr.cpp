@@ -52,6 +52,11 @@ VamMgr::VamMgr()
         m_vaRangeInfo[partIndex].baseVirtualAddr = 0;
         m_vaRangeInfo[partIndex].size            = 0;
     }
+
+    for (uint32 classIndex = 0; classIndex < VaCacheNumClasses; classIndex++)
+    {
+        m_vaCache[classIndex].count = 0;
+    }
 }
 
 // =====================================================================================================================
@@ -151,37 +156,68 @@ Result VamMgr::AssignVirtualAddress(
     const VirtAddrAssignInfo&  vaInfo,
     gpusize*                   pGpuVirtAddr)  // [in/out] In: Zero, or the desired VA. Out: The assigned VA.
 {
-    Result result = Result::Success;
+    Result result = Result::ErrorOutOfGpuMemory;
 
-    VAM_ALLOC_INPUT  vamAllocIn  = { };
-    VAM_ALLOC_OUTPUT vamAllocOut = { };
+    // Requests for a specific VA or with an alignment stricter than what the cached ranges guarantee go to VAM.
+    const uint32  cacheDepth  = Min(pDevice->Settings().vamVaCacheDepth, VaCacheMaxDepth);
+    VaCacheClass* pCacheClass = ((*pGpuVirtAddr == 0) && (cacheDepth > 0) &&
+                                 (vaInfo.alignment <= VaCacheAlignment(vaInfo.size)))
+                                ? GetVaCacheClass(vaInfo.partition, vaInfo.size)
+                                : nullptr;
 
-    vamAllocIn.virtualAddress = *pGpuVirtAddr;
-    vamAllocIn.sizeInBytes    = vaInfo.size;
-    vamAllocIn.alignment      = Max(LowPart(vaInfo.alignment), MinVamAllocAlignment);
+    if (pCacheClass != nullptr)
+    {
+        MutexAuto cacheLock(&pCacheClass->lock);
 
-    // VAM takes a 32-bit alignment so the high part needs to be zero.
-    PAL_ASSERT(HighPart(vaInfo.alignment) == 0);
+        if ((pCacheClass->count > 0) ||
+            (RefillVaCache(pCacheClass, vaInfo.partition, vaInfo.size, Max(cacheDepth / 2, 1u)) > 0))
+        {
+            *pGpuVirtAddr = pCacheClass->ranges[--pCacheClass->count];
+            result        = Result::Success;
+        }
+    }
 
-    vamAllocIn.hSection = m_hSection[static_cast<uint32>(vaInfo.partition)];
-    PAL_ASSERT(vamAllocIn.hSection != nullptr);
+    if (result != Result::Success)
+    {
+        VAM_ALLOC_INPUT  vamAllocIn  = { };
+        VAM_ALLOC_OUTPUT vamAllocOut = { };
 
-    MutexAuto lock(&m_mutex);
+        vamAllocIn.virtualAddress = *pGpuVirtAddr;
+        vamAllocIn.sizeInBytes    = vaInfo.size;
+        vamAllocIn.alignment      = Max(LowPart(vaInfo.alignment), MinVamAllocAlignment);
 
-    if (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) == VAM_OK)
-    {
-        // Applications are expected to size-align their allocations to the largest size-alignment amongst the
-        // heaps they want the allocation to go into.
-        PAL_ASSERT(vamAllocOut.actualSize == vamAllocIn.sizeInBytes);
+        // VAM takes a 32-bit alignment so the high part needs to be zero.
+        PAL_ASSERT(HighPart(vaInfo.alignment) == 0);
 
-        // If the caller had a particular VA in mind we should make sure VAM gave it to us.
-        PAL_ASSERT((*pGpuVirtAddr == 0) || (*pGpuVirtAddr == vamAllocOut.virtualAddress));
+        vamAllocIn.hSection = m_hSection[static_cast<uint32>(vaInfo.partition)];
+        PAL_ASSERT(vamAllocIn.hSection != nullptr);
 
-        *pGpuVirtAddr = vamAllocOut.virtualAddress;
-    }
-    else
-    {
-        result = Result::ErrorOutOfGpuMemory;
+        bool success = false;
+        {
+            MutexAuto lock(&m_mutex);
+            success = (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) == VAM_OK);
+        }
+
+        // The cached ranges may be what stands in the way (e.g., a fragmented partition or a desired VA which is
+        // sitting in a cache), so give them back to VAM and try once more.
+        if ((success == false) && FlushVaCaches(vaInfo.partition))
+        {
+            MutexAuto lock(&m_mutex);
+            success = (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) == VAM_OK);
+        }
+
+        if (success)
+        {
+            // Applications are expected to size-align their allocations to the largest size-alignment amongst the
+            // heaps they want the allocation to go into.
+            PAL_ASSERT(vamAllocOut.actualSize == vamAllocIn.sizeInBytes);
+
+            // If the caller had a particular VA in mind we should make sure VAM gave it to us.
+            PAL_ASSERT((*pGpuVirtAddr == 0) || (*pGpuVirtAddr == vamAllocOut.virtualAddress));
+
+            *pGpuVirtAddr = vamAllocOut.virtualAddress;
+            result        = Result::Success;
+        }
     }
 
     return result;
@@ -201,22 +237,157 @@ Result VamMgr::FreeVirtualAddress(
     PAL_ASSERT((pGpuMemory != nullptr) &&
                IsVamPartition(pGpuMemory->VirtAddrPartition()));
 
-    VAM_FREE_INPUT vamFreeIn = { };
-    vamFreeIn.virtualAddress = pGpuMemory->Desc().gpuVirtAddr;
-    vamFreeIn.actualSize     = pGpuMemory->Desc().size;
-    vamFreeIn.hSection       = m_hSection[static_cast<uint32>(pGpuMemory->VirtAddrPartition())];
+    const gpusize     gpuVirtAddr = pGpuMemory->Desc().gpuVirtAddr;
+    const gpusize     size        = pGpuMemory->Desc().size;
+    const VaPartition partition   = pGpuMemory->VirtAddrPartition();
 
-    MutexAuto lock(&m_mutex);
+    // Only ranges which satisfy the cache's alignment guarantee can be handed out again by AssignVirtualAddress().
+    const uint32  cacheDepth  = Min(pDevice->Settings().vamVaCacheDepth, VaCacheMaxDepth);
+    VaCacheClass* pCacheClass = ((cacheDepth > 0) && IsPow2Aligned(gpuVirtAddr, VaCacheAlignment(size)))
+                                ? GetVaCacheClass(partition, size)
+                                : nullptr;
+
+    if (pCacheClass != nullptr)
+    {
+        MutexAuto cacheLock(&pCacheClass->lock);
+
+        if (pCacheClass->count >= cacheDepth)
+        {
+            TrimVaCache(pCacheClass, partition, size, cacheDepth / 2);
+        }
 
-    if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
+        pCacheClass->ranges[pCacheClass->count++] = gpuVirtAddr;
+    }
+    else
     {
-        PAL_ASSERT_ALWAYS();
-        result = Result::ErrorOutOfGpuMemory;
+        VAM_FREE_INPUT vamFreeIn = { };
+        vamFreeIn.virtualAddress = gpuVirtAddr;
+        vamFreeIn.actualSize     = size;
+        vamFreeIn.hSection       = m_hSection[static_cast<uint32>(partition)];
+
+        MutexAuto lock(&m_mutex);
+
+        if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
+        {
+            PAL_ASSERT_ALWAYS();
+            result = Result::ErrorOutOfGpuMemory;
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Returns the VA cache size class which serves allocations of the given size from the given partition, or null if such
+// allocations are not cached. Only exact multiples of the cache granularity are cached so that every cached range is
+// precisely the size VAM will be told when it is eventually freed. Only the descriptor table partition is cached:
+// shadow descriptor tables always request a fixed VA (mirroring their descriptor table), which a cache can't serve.
+VamMgr::VaCacheClass* VamMgr::GetVaCacheClass(
+    VaPartition vaPartition,
+    gpusize     size)
+{
+    VaCacheClass* pCacheClass = nullptr;
+
+    if ((vaPartition == VaPartition::DescriptorTable) &&
+        (size > 0) && IsPow2Aligned(size, VaCacheGranularity) && (size <= (VaCacheNumClasses * VaCacheGranularity)))
+    {
+        pCacheClass = &m_vaCache[static_cast<uint32>(size / VaCacheGranularity) - 1];
+    }
+
+    return pCacheClass;
+}
+
+// =====================================================================================================================
+// Allocates up to numRanges VA ranges of the class size from VAM under a single acquisition of the global lock and
+// adds them to the cache. Returns the number of ranges added. The caller must hold the cache class lock.
+uint32 VamMgr::RefillVaCache(
+    VaCacheClass* pCacheClass,
+    VaPartition   vaPartition,
+    gpusize       size,
+    uint32        numRanges)
+{
+    PAL_ASSERT((pCacheClass->count + numRanges) <= VaCacheMaxDepth);
+
+    VAM_ALLOC_INPUT vamAllocIn = { };
+    vamAllocIn.sizeInBytes = size;
+    vamAllocIn.alignment   = Max(LowPart(VaCacheAlignment(size)), MinVamAllocAlignment);
+    vamAllocIn.hSection    = m_hSection[static_cast<uint32>(vaPartition)];
+    PAL_ASSERT(vamAllocIn.hSection != nullptr);
+
+    uint32 numAdded = 0;
+
+    MutexAuto lock(&m_mutex);
+
+    for (; numAdded < numRanges; numAdded++)
+    {
+        VAM_ALLOC_OUTPUT vamAllocOut = { };
+
+        if (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) != VAM_OK)
+        {
+            break;
+        }
+
+        PAL_ASSERT(vamAllocOut.actualSize == vamAllocIn.sizeInBytes);
+        pCacheClass->ranges[pCacheClass->count++] = vamAllocOut.virtualAddress;
+    }
+
+    return numAdded;
+}
+
+// =====================================================================================================================
+// Returns cached VA ranges to VAM under a single acquisition of the global lock until only keepCount remain. The caller
+// must hold the cache class lock.
+void VamMgr::TrimVaCache(
+    VaCacheClass* pCacheClass,
+    VaPartition   vaPartition,
+    gpusize       size,
+    uint32        keepCount)
+{
+    if (pCacheClass->count > keepCount)
+    {
+        VAM_FREE_INPUT vamFreeIn = { };
+        vamFreeIn.actualSize = size;
+        vamFreeIn.hSection   = m_hSection[static_cast<uint32>(vaPartition)];
+
+        MutexAuto lock(&m_mutex);
+
+        while (pCacheClass->count > keepCount)
+        {
+            vamFreeIn.virtualAddress = pCacheClass->ranges[--pCacheClass->count];
+
+            if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
+            {
+                PAL_ASSERT_ALWAYS();
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns every cached VA range of the given partition to VAM. Returns true if any range was released. Must not be
+// called while holding a cache class lock or m_mutex.
+bool VamMgr::FlushVaCaches(
+    VaPartition vaPartition)
+{
+    bool released = false;
+
+    for (uint32 classIndex = 0; classIndex < VaCacheNumClasses; classIndex++)
+    {
+        const gpusize size        = (classIndex + 1) * VaCacheGranularity;
+        VaCacheClass* pCacheClass = GetVaCacheClass(vaPartition, size);
+
+        if (pCacheClass != nullptr)
+        {
+            MutexAuto cacheLock(&pCacheClass->lock);
+
+            released |= (pCacheClass->count > 0);
+            TrimVaCache(pCacheClass, vaPartition, size, 0);
+        }
+    }
+
+    return released;
+}
+
 // =====================================================================================================================
 // Creates a GPU memory object for a page table block.  This method is protected by VAM's use of m_vamSyncObj.
 Result VamMgr::AllocPageTableBlock(
@@ -255,6 +426,9 @@ bool VamMgr::IsVamPartition(
 Result VamMgr::Cleanup(
     Pal::Device* pDevice)
 {
+    // Cached VA ranges still belong to VAM and must be released before its sections are destroyed.
+    FlushVaCaches(VaPartition::DescriptorTable);
+
     FreeReservedVaRanges(static_cast<Device*>(pDevice));
 
     return Pal::VamMgr::Cleanup(pDevice);
@@ -124,6 +124,42 @@ protected:
     void FreeReservedVaRanges(
         Device* pDevice);
 
+    // Small VA ranges in the descriptor table partition are recycled through per-size-class caches which sit in front
+    // of VAM. Each class has its own lock so that most assignments and frees never touch m_mutex.
+    static constexpr gpusize VaCacheGranularity  = 4096;
+    static constexpr uint32  VaCacheNumClasses   = 64;       // Covers sizes up to 256KB.
+    static constexpr uint32  VaCacheMaxDepth     = 32;
+    static constexpr gpusize VaCacheMaxAlignment = 64 * 1024;
+
+    struct VaCacheClass
+    {
+        Util::Mutex lock;                         // Protects the fields below.
+        uint32      count;                        // Number of valid entries in ranges.
+        gpusize     ranges[VaCacheMaxDepth];      // Free VA ranges owned by VAM, each exactly the class size.
+    };
+
+    VaCacheClass* GetVaCacheClass(
+        VaPartition vaPartition,
+        gpusize     size);
+
+    static gpusize VaCacheAlignment(gpusize size)
+        { return Util::Min(Util::Pow2Pad(size), VaCacheMaxAlignment); }
+
+    uint32 RefillVaCache(
+        VaCacheClass* pCacheClass,
+        VaPartition   vaPartition,
+        gpusize       size,
+        uint32        numRanges);
+
+    void TrimVaCache(
+        VaCacheClass* pCacheClass,
+        VaPartition   vaPartition,
+        gpusize       size,
+        uint32        keepCount);
+
+    bool FlushVaCaches(
+        VaPartition vaPartition);
+
     // VAM callbacks.
     static void*             VAM_STDCALL AllocSysMemCb(VAM_CLIENT_HANDLE hPal, uint32 sizeInBytes);
     static VAM_RETURNCODE    VAM_STDCALL FreeSysMemCb(VAM_CLIENT_HANDLE hPal, void* pAddress);
@@ -150,6 +186,8 @@ protected:
     Util::GenericAllocatorTracked m_mapAllocator;
     SharedBoMap                   m_sharedBoMap;
 
+    VaCacheClass                  m_vaCache[VaCacheNumClasses];  // VaPartition::DescriptorTable is the only one cached.
+
     static constexpr uint32 InitialBoCount = 8;
 };
 
@@ -311,6 +311,12 @@ Queue::Queue(
     m_stalled(false),
     m_batchedSubmissionCount(0),
     m_batchedCmds(pDevice->GetPlatform()),
+    m_pBatchedCmdMemCache{},
+    m_batchedCmdMemCacheCount(0),
+    m_asyncSubmit(false),
+    m_asyncCmdInFlight(false),
+    m_asyncSubmitResult(Result::Success),
+    m_submitThreadEnd(false),
     m_deviceMembershipNode(this),
     m_queueId(g_nextQueueId.fetch_add(1, std::memory_order_relaxed)),
     m_lastFrameCnt(0),
@@ -330,6 +336,88 @@ Queue::~Queue()
     {
         PAL_SAFE_DELETE_ARRAY(m_pQueueInfos, m_pDevice->GetPlatform());
     }
+
+    for (uint32 idx = 0; idx < m_batchedCmdMemCacheCount; ++idx)
+    {
+        PAL_FREE(m_pBatchedCmdMemCache[idx], m_pDevice->GetPlatform());
+    }
+}
+
+// =====================================================================================================================
+// Every batched allocation starts with this header so that FreeBatchedCmdMem() knows how large the block is. It is
+// padded to keep the payload as aligned as the allocation itself.
+struct BatchedCmdMemHeader
+{
+    size_t size; // Usable size of the block, not including this header.
+    size_t padding;
+};
+
+// Batched allocations are rounded up to a power of two no smaller than this so that they are likely to be reusable.
+constexpr size_t MinBatchedCmdMemSize = 512;
+
+// =====================================================================================================================
+// Allocates memory for the payload of a batched command, preferring a recycled block from an earlier command. The
+// caller must hold m_batchedCmdsLock.
+void* Queue::AllocBatchedCmdMem(
+    size_t size)
+{
+    void*  pBlock   = nullptr;
+    uint32 bestSlot = m_batchedCmdMemCacheCount;
+    size_t bestSize = SIZE_MAX;
+
+    // Pick the smallest cached block which is large enough.
+    for (uint32 idx = 0; idx < m_batchedCmdMemCacheCount; ++idx)
+    {
+        const size_t cachedSize = static_cast<const BatchedCmdMemHeader*>(m_pBatchedCmdMemCache[idx])->size;
+
+        if ((cachedSize >= size) && (cachedSize < bestSize))
+        {
+            bestSlot = idx;
+            bestSize = cachedSize;
+        }
+    }
+
+    if (bestSlot < m_batchedCmdMemCacheCount)
+    {
+        pBlock = m_pBatchedCmdMemCache[bestSlot];
+
+        m_batchedCmdMemCacheCount--;
+        m_pBatchedCmdMemCache[bestSlot] = m_pBatchedCmdMemCache[m_batchedCmdMemCacheCount];
+    }
+    else
+    {
+        const size_t blockSize = Pow2Pad(Max(size, MinBatchedCmdMemSize));
+
+        pBlock = PAL_MALLOC(sizeof(BatchedCmdMemHeader) + blockSize, m_pDevice->GetPlatform(), AllocInternal);
+
+        if (pBlock != nullptr)
+        {
+            static_cast<BatchedCmdMemHeader*>(pBlock)->size = blockSize;
+        }
+    }
+
+    return (pBlock != nullptr) ? VoidPtrInc(pBlock, sizeof(BatchedCmdMemHeader)) : nullptr;
+}
+
+// =====================================================================================================================
+// Returns memory from AllocBatchedCmdMem() to the cache, or frees it if the cache is full. The caller must hold
+// m_batchedCmdsLock.
+void Queue::FreeBatchedCmdMem(
+    void* pMem)
+{
+    if (pMem != nullptr)
+    {
+        void*const pBlock = VoidPtrDec(pMem, sizeof(BatchedCmdMemHeader));
+
+        if (m_batchedCmdMemCacheCount < MaxCachedBatchedCmdMem)
+        {
+            m_pBatchedCmdMemCache[m_batchedCmdMemCacheCount++] = pBlock;
+        }
+        else
+        {
+            PAL_FREE(pBlock, m_pDevice->GetPlatform());
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -337,6 +425,14 @@ Queue::~Queue()
 // queues' virtual functions.
 void Queue::Destroy()
 {
+    // The submit thread drains any remaining batched commands before it exits.
+    if (m_submitThread.IsCreated())
+    {
+        m_submitThreadEnd = true;
+        m_submitThreadNotify.Post();
+        m_submitThread.Join();
+    }
+
     // NOTE: If there are still outstanding batched commands for this Queue, something has gone very wrong!
     PAL_ASSERT(m_batchedCmds.NumElements() == 0);
 
@@ -626,11 +722,19 @@ Result Queue::SubmitInternal(
     AutoBuffer<InternalSubmitInfo, 8, Platform> internalSubmitInfos(
         submitInfo.perSubQueueInfoCount, m_pDevice->GetPlatform());
 
-    if (internalSubmitInfos.Capacity() < submitInfo.perSubQueueInfoCount)
+    // If the submit thread failed an earlier submission (e.g., the device was lost), report that instead of this
+    // submission. This must happen before any of the command buffer and fence bookkeeping below, which assumes that
+    // the submission will be executed.
+    if (m_asyncSubmit && (postBatching == false))
+    {
+        result = TakeAsyncSubmitResult();
+    }
+
+    if ((result == Result::Success) && (internalSubmitInfos.Capacity() < submitInfo.perSubQueueInfoCount))
     {
         result = Result::ErrorOutOfMemory;
     }
-    else
+    else if (result == Result::Success)
     {
         memset(internalSubmitInfos.Data(), 0, sizeof(InternalSubmitInfo) * Max(1u, submitInfo.perSubQueueInfoCount));
         for (uint32 qIndex = 0; (qIndex < submitInfo.perSubQueueInfoCount) && (result == Result::Success); qIndex++)
@@ -726,7 +830,7 @@ Result Queue::SubmitInternal(
 
         // Either execute the submission immediately, or enqueue it for later, depending on whether or not we are
         // stalled and/or the caller is a function after the batching logic and thus must execute immediately.
-        if (postBatching || (m_stalled == false))
+        if (postBatching || (MayBatchCmd() == false))
         {
             result = OsSubmit(submitInfo, &internalSubmitInfos[0]);
         }
@@ -996,7 +1100,14 @@ Result Queue::WaitIdle()
 
     // When we get here, all batched operations (if there were any) have been processed, so wait for the OS-specific
     // Queue to become idle.
-    return OsWaitIdle();
+    result = OsWaitIdle();
+
+    if ((result == Result::Success) && m_asyncSubmit)
+    {
+        result = TakeAsyncSubmitResult();
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -1019,7 +1130,7 @@ Result Queue::SignalQueueSemaphoreInternal(
 
     // Either signal the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (MayBatchCmd() == false))
     {
         // The Semaphore object is responsible for notifying any stalled Queues which may get released by this signal
         // operation.
@@ -1031,7 +1142,7 @@ Result Queue::SignalQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (MustBatchCmd())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::SignalSemaphore;
@@ -1070,7 +1181,7 @@ Result Queue::WaitQueueSemaphoreInternal(
 
     // Either wait on the semaphore immediately, or enqueue it for later, depending on whether or not we are stalled
     // and/or the caller is a function after the batching logic and thus must execute immediately.
-    if (postBatching || (m_stalled == false))
+    if (postBatching || (MayBatchCmd() == false))
     {
         // If this Queue isn't stalled yet, we can execute the wait immediately (which, of course, could stall
         // this Queue).
@@ -1082,7 +1193,7 @@ Result Queue::WaitQueueSemaphoreInternal(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (MustBatchCmd())
         {
             BatchedQueueCmdData cmdData  = { };
             cmdData.command              = BatchedQueueCmd::WaitSemaphore;
@@ -1129,7 +1240,7 @@ Result Queue::PresentDirectInternal(
         {
             // Either execute the present immediately, or enqueue it for later, depending on whether or not we are
             // stalled.
-            if (m_stalled == false)
+            if (MayBatchCmd() == false)
             {
                 result = OsPresentDirect(presentInfo);
             }
@@ -1139,7 +1250,7 @@ Result Queue::PresentDirectInternal(
                 // this path didn't take the lock beforehand, so its possible that another thread released this Queue
                 // from the stalled state before we were able to get into this method.
                 MutexAuto lock(&m_batchedCmdsLock);
-                if (m_stalled)
+                if (MustBatchCmd())
                 {
                     BatchedQueueCmdData cmdData = {};
                     cmdData.command             = BatchedQueueCmd::PresentDirect;
@@ -1307,7 +1418,7 @@ Result Queue::CopyVirtualMemoryPageMappings(
     Result result = Result::ErrorUnavailable;
 
     // Either execute the delay immediately, or enqueue it for later, depending on whether or not we are stalled.
-    if (m_stalled == false)
+    if (MayBatchCmd() == false)
     {
         result = OsCopyVirtualMemoryPageMappings(rangeCount, pRanges, doNotWait);
     }
@@ -1317,7 +1428,7 @@ Result Queue::CopyVirtualMemoryPageMappings(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (MustBatchCmd())
         {
             BatchedQueueCmdData cmdData = { };
             cmdData.command    = BatchedQueueCmd::CopyVirtualMemoryPageMappings;
@@ -1325,8 +1436,8 @@ Result Queue::CopyVirtualMemoryPageMappings(
             cmdData.copyVirtualMemoryPageMappings.doNotWait   = doNotWait;
             if (rangeCount > 0)
             {
-                cmdData.copyVirtualMemoryPageMappings.pRanges = PAL_NEW_ARRAY(VirtualMemoryCopyPageMappingsRange,
-                    rangeCount, m_pDevice->GetPlatform(), AllocInternal);
+                cmdData.copyVirtualMemoryPageMappings.pRanges = static_cast<VirtualMemoryCopyPageMappingsRange*>(
+                    AllocBatchedCmdMem(rangeCount * sizeof(VirtualMemoryCopyPageMappingsRange)));
                 if (cmdData.copyVirtualMemoryPageMappings.pRanges == nullptr)
                 {
                     result = Result::ErrorOutOfMemory;
@@ -1363,7 +1474,7 @@ Result Queue::RemapVirtualMemoryPages(
     Result result = Result::ErrorUnavailable;
 
     // Either execute the delay immediately, or enqueue it for later, depending on whether or not we are stalled.
-    if (m_stalled == false)
+    if (MayBatchCmd() == false)
     {
         result = OsRemapVirtualMemoryPages(rangeCount, pRanges, doNotWait, pFence);
     }
@@ -1373,7 +1484,7 @@ Result Queue::RemapVirtualMemoryPages(
         // this path didn't take the lock beforehand, so its possible that another thread released this Queue
         // from the stalled state before we were able to get into this method.
         MutexAuto lock(&m_batchedCmdsLock);
-        if (m_stalled)
+        if (MustBatchCmd())
         {
             BatchedQueueCmdData cmdData = { };
             cmdData.command    = BatchedQueueCmd::RemapVirtualMemoryPages;
@@ -1382,8 +1493,8 @@ Result Queue::RemapVirtualMemoryPages(
             cmdData.remapVirtualMemoryPages.pFence      = pFence;
             if (rangeCount > 0)
             {
-                cmdData.remapVirtualMemoryPages.pRanges = PAL_NEW_ARRAY(VirtualMemoryRemapRange, rangeCount,
-                    m_pDevice->GetPlatform(), AllocInternal);
+                cmdData.remapVirtualMemoryPages.pRanges = static_cast<VirtualMemoryRemapRange*>(
+                    AllocBatchedCmdMem(rangeCount * sizeof(VirtualMemoryRemapRange)));
                 if (cmdData.remapVirtualMemoryPages.pRanges == nullptr)
                 {
                     result = Result::ErrorOutOfMemory;
@@ -1423,7 +1534,7 @@ Result Queue::AssociateFenceWithLastSubmit(
         pCoreFence->AssociateWithContext(m_pSubmissionContext);
 
         // Either associate the fence timestamp immediately or later, depending on whether or not we are stalled.
-        if (m_stalled == false)
+        if (MayBatchCmd() == false)
         {
             result = DoAssociateFenceWithLastSubmit(pCoreFence);
         }
@@ -1434,7 +1545,7 @@ Result Queue::AssociateFenceWithLastSubmit(
             // from the stalled state before we were able to get into this method.
             MutexAuto lock(&m_batchedCmdsLock);
 
-            if (m_stalled)
+            if (MustBatchCmd())
             {
                 BatchedQueueCmdData cmdData = { };
                 cmdData.command               = BatchedQueueCmd::AssociateFenceWithLastSubmit;
@@ -1533,6 +1644,28 @@ Result Queue::LateInit()
         }
     }
 
+    // Timer queues have nothing to submit, so they never use a submit thread. Failing to start the thread is not fatal;
+    // the queue just keeps submitting from the caller's thread.
+    if ((result == Result::Success) && m_pDevice->Settings().asyncQueueSubmission && (Type() != QueueTypeTimer))
+    {
+        Result threadResult = m_submitThreadNotify.Init(Semaphore::MaximumCountLimit, 0);
+
+        if (threadResult == Result::Success)
+        {
+            threadResult = m_submitThread.Begin(&SubmitThreadFunc, this);
+        }
+
+        if (threadResult == Result::Success)
+        {
+            m_submitThread.SetThreadName("PalQueueSubmit");
+            m_asyncSubmit = true;
+        }
+        else
+        {
+            PAL_ALERT_ALWAYS_MSG("Failed to start the queue submit thread, submitting synchronously instead.");
+        }
+    }
+
     return result;
 }
 
@@ -1563,69 +1696,174 @@ Result Queue::ReleaseFromStalledState(
         result = m_batchedCmds.PopFront(&cmdData);
         PAL_ASSERT(result == Result::Success);
 
-        switch (cmdData.command)
+        if ((cmdData.command == BatchedQueueCmd::Submit) && (pWaitingSemaphore != nullptr) && (hasSubmit == false))
         {
-        case BatchedQueueCmd::Submit:
-            if ((pWaitingSemaphore != nullptr) && (hasSubmit == false))
-            {
-                // The Semaphore has been signaled already by some other Queue or client, so it is safe to submit the Wait request
-                // from the OS' perspective.
-                pWaitingSemaphore->WaitNoBatching(this, value);
-                hasSubmit = true;
-            }
-            result = OsSubmit(cmdData.submit.submitInfo, cmdData.submit.pInternalSubmitInfo);
-            // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
-            // in the same memory allocation which was saved in pDynamicMem for convenience.
-            PAL_SAFE_FREE(cmdData.submit.pDynamicMem, m_pDevice->GetPlatform());
+            // The Semaphore has been signaled already by some other Queue or client, so it is safe to submit the Wait request
+            // from the OS' perspective.
+            pWaitingSemaphore->WaitNoBatching(this, value);
+            hasSubmit = true;
+        }
 
-            // Decrement this count to permit WaitIdle to query the status of the queue's submissions.
-            PAL_ASSERT(m_batchedSubmissionCount > 0);
-            AtomicDecrement(&m_batchedSubmissionCount);
-            break;
+        result = ExecuteBatchedCmd(cmdData, &stalledAgain);
+    }
 
-        case BatchedQueueCmd::SignalSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Signal(this, cmdData.semaphore.value);
-            break;
+    // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
+    // one of the batched-up commands caused this Queue to become stalled again.
+    m_stalled = stalledAgain;
 
-        case BatchedQueueCmd::WaitSemaphore:
-            result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Wait(this, cmdData.semaphore.value,
-                                                                                      &stalledAgain);
-            break;
+    return result;
+}
 
-        case BatchedQueueCmd::PresentDirect:
-            result = OsPresentDirect(cmdData.presentDirect.info);
-            break;
+// =====================================================================================================================
+// Executes a single batched-up command. Sets pStalledAgain if the command caused this Queue to become stalled.
+Result Queue::ExecuteBatchedCmd(
+    const BatchedQueueCmdData& cmdData,
+    bool*                      pStalledAgain)
+{
+    Result result = Result::Success;
 
-        case BatchedQueueCmd::Delay:
-            PAL_ASSERT(Type() == QueueTypeTimer);
-            result = OsDelay(cmdData.delay, nullptr);
-            break;
+    switch (cmdData.command)
+    {
+    case BatchedQueueCmd::Submit:
+        result = OsSubmit(cmdData.submit.submitInfo, cmdData.submit.pInternalSubmitInfo);
+        // Once we've executed the submission, we need to free the submission's dynamic arrays. They are all stored
+        // in the same memory allocation which was saved in pDynamicMem for convenience.
+        FreeBatchedCmdMem(cmdData.submit.pDynamicMem);
 
-        case BatchedQueueCmd::RemapVirtualMemoryPages:
-            result = OsRemapVirtualMemoryPages(cmdData.remapVirtualMemoryPages.rangeCount,
-                                               cmdData.remapVirtualMemoryPages.pRanges,
-                                               cmdData.remapVirtualMemoryPages.doNotWait,
-                                               cmdData.remapVirtualMemoryPages.pFence);
-            PAL_SAFE_DELETE_ARRAY(cmdData.remapVirtualMemoryPages.pRanges, m_pDevice->GetPlatform());
-            break;
+        // Decrement this count to permit WaitIdle to query the status of the queue's submissions.
+        PAL_ASSERT(m_batchedSubmissionCount > 0);
+        AtomicDecrement(&m_batchedSubmissionCount);
+        break;
 
-        case BatchedQueueCmd::CopyVirtualMemoryPageMappings:
-            result = OsCopyVirtualMemoryPageMappings(cmdData.copyVirtualMemoryPageMappings.rangeCount,
-                                               cmdData.copyVirtualMemoryPageMappings.pRanges,
-                                               cmdData.copyVirtualMemoryPageMappings.doNotWait);
-            PAL_SAFE_DELETE_ARRAY(cmdData.copyVirtualMemoryPageMappings.pRanges, m_pDevice->GetPlatform());
-            break;
+    case BatchedQueueCmd::SignalSemaphore:
+        result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Signal(this, cmdData.semaphore.value);
+        break;
 
-        case BatchedQueueCmd::AssociateFenceWithLastSubmit:
-            result = DoAssociateFenceWithLastSubmit(cmdData.associateFence.pFence);
-            break;
+    case BatchedQueueCmd::WaitSemaphore:
+        result = static_cast<QueueSemaphore*>(cmdData.semaphore.pSemaphore)->Wait(this, cmdData.semaphore.value,
+                                                                                  pStalledAgain);
+        break;
+
+    case BatchedQueueCmd::PresentDirect:
+        result = OsPresentDirect(cmdData.presentDirect.info);
+        break;
+
+    case BatchedQueueCmd::Delay:
+        PAL_ASSERT(Type() == QueueTypeTimer);
+        result = OsDelay(cmdData.delay, nullptr);
+        break;
 
+    case BatchedQueueCmd::RemapVirtualMemoryPages:
+        result = OsRemapVirtualMemoryPages(cmdData.remapVirtualMemoryPages.rangeCount,
+                                           cmdData.remapVirtualMemoryPages.pRanges,
+                                           cmdData.remapVirtualMemoryPages.doNotWait,
+                                           cmdData.remapVirtualMemoryPages.pFence);
+        FreeBatchedCmdMem(cmdData.remapVirtualMemoryPages.pRanges);
+        break;
+
+    case BatchedQueueCmd::CopyVirtualMemoryPageMappings:
+        result = OsCopyVirtualMemoryPageMappings(cmdData.copyVirtualMemoryPageMappings.rangeCount,
+                                           cmdData.copyVirtualMemoryPageMappings.pRanges,
+                                           cmdData.copyVirtualMemoryPageMappings.doNotWait);
+        FreeBatchedCmdMem(cmdData.copyVirtualMemoryPageMappings.pRanges);
+        break;
+
+    case BatchedQueueCmd::AssociateFenceWithLastSubmit:
+        result = DoAssociateFenceWithLastSubmit(cmdData.associateFence.pFence);
+        break;
+
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Entry point of the submit thread started by LateInit() when the AsyncQueueSubmission setting is enabled.
+void Queue::SubmitThreadFunc(
+    void* pParameter)
+{
+    Queue*const pQueue = static_cast<Queue*>(pParameter);
+
+    while (pQueue->m_submitThreadEnd == false)
+    {
+        pQueue->m_submitThreadNotify.Wait(std::chrono::milliseconds::max());
+        pQueue->ProcessAsyncCmds();
+    }
+}
+
+// =====================================================================================================================
+// Executes batched-up commands on the submit thread until there are none left or this Queue becomes stalled, in which
+// case ReleaseFromStalledState() will execute the remaining commands.
+void Queue::ProcessAsyncCmds()
+{
+    m_batchedCmdsLock.Lock();
+
+    while ((m_stalled == false) && (m_batchedCmds.NumElements() > 0))
+    {
+        BatchedQueueCmdData cmdData = { };
+
+        Result result = m_batchedCmds.PopFront(&cmdData);
+        PAL_ASSERT(result == Result::Success);
+
+        if (cmdData.command == BatchedQueueCmd::Submit)
+        {
+            // A submission can't stall this Queue, so the OS submit is done without holding the lock. This is what lets
+            // the client thread prepare and batch up its next submission in the meantime. m_asyncCmdInFlight forces
+            // any other queue command to be batched behind this one until it's done.
+            m_asyncCmdInFlight = true;
+            m_batchedCmdsLock.Unlock();
+
+            result = OsSubmit(cmdData.submit.submitInfo, cmdData.submit.pInternalSubmitInfo);
+
+            m_batchedCmdsLock.Lock();
+            m_asyncCmdInFlight = false;
+
+            // Submit() already associated this submission's fences with our submission context, so they would never
+            // signal if the submission is dropped. Associate them with the last successful submission instead so
+            // that waiting on them can't hang; the error itself is reported by the next Submit() or WaitIdle().
+            if (result != Result::Success)
+            {
+                const MultiSubmitInfo& submitInfo = cmdData.submit.submitInfo;
+
+                for (uint32 idx = 0; idx < submitInfo.fenceCount; idx++)
+                {
+                    DoAssociateFenceWithLastSubmit(static_cast<Fence*>(submitInfo.ppFences[idx]));
+                }
+            }
+
+            FreeBatchedCmdMem(cmdData.submit.pDynamicMem);
+
+            PAL_ASSERT(m_batchedSubmissionCount > 0);
+            AtomicDecrement(&m_batchedSubmissionCount);
+        }
+        else
+        {
+            bool stalled = false;
+            result = ExecuteBatchedCmd(cmdData, &stalled);
+
+            m_stalled = stalled;
+        }
+
+        // There's no caller to return errors to, so hold on to the first one until the next Submit() or WaitIdle().
+        if ((result != Result::Success) && (m_asyncSubmitResult == Result::Success))
+        {
+            PAL_ALERT_ALWAYS();
+            m_asyncSubmitResult = result;
         }
     }
 
-    // Update our stalled status: either we've completely drained all batched-up commands and are not stalled, or
-    // one of the batched-up commands caused this Queue to become stalled again.
-    m_stalled = stalledAgain;
+    m_batchedCmdsLock.Unlock();
+}
+
+// =====================================================================================================================
+// Returns the first error reported by the submit thread since the last call, if any, and clears it so that it's only
+// reported once.
+Result Queue::TakeAsyncSubmitResult()
+{
+    MutexAuto lock(&m_batchedCmdsLock);
+
+    const Result result = m_asyncSubmitResult;
+    m_asyncSubmitResult = Result::Success;
 
     return result;
 }
@@ -1758,9 +1996,9 @@ Result Queue::EnqueueSubmit(
 
     // After taking the lock, check again to see if we're stalled. The original check which brought us down this path
     // didn't take the lock beforehand, so its possible that another thread released this Queue from the stalled state
-    // before we were able to get into this method.
+    // before we were able to get into this method. In asynchronous mode, submissions are always batched.
     MutexAuto lock(&m_batchedCmdsLock);
-    if (m_stalled)
+    if (m_stalled || m_asyncSubmit)
     {
         BatchedQueueCmdData cmdData;
         cmdData.command                    = BatchedQueueCmd::Submit;
@@ -1812,7 +2050,7 @@ Result Queue::EnqueueSubmit(
 
         if (totalBytes > 0)
         {
-            cmdData.submit.pDynamicMem = PAL_MALLOC(totalBytes, m_pDevice->GetPlatform(), AllocInternal);
+            cmdData.submit.pDynamicMem = AllocBatchedCmdMem(totalBytes);
 
             if (cmdData.submit.pDynamicMem == nullptr)
             {
@@ -1919,10 +2157,15 @@ Result Queue::EnqueueSubmit(
                 // We must track the number of batched submissions to make WaitIdle spin until all submissions have been
                 // submitted to the OS layer.
                 AtomicIncrement(&m_batchedSubmissionCount);
+
+                if (m_asyncSubmit)
+                {
+                    m_submitThreadNotify.Post();
+                }
             }
             else
             {
-                PAL_SAFE_FREE(cmdData.submit.pDynamicMem, m_pDevice->GetPlatform());
+                FreeBatchedCmdMem(cmdData.submit.pDynamicMem);
             }
         }
     }
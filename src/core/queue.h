@@ -31,6 +31,8 @@
 #include "palDeque.h"
 #include "palIntrusiveList.h"
 #include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -417,6 +419,23 @@ private:
         IQueueSemaphore* pQueueSemaphore,
         volatile bool*   pIsStalled);
 
+    void* AllocBatchedCmdMem(size_t size);
+    void  FreeBatchedCmdMem(void* pMem);
+
+    Result ExecuteBatchedCmd(const BatchedQueueCmdData& cmdData, bool* pStalledAgain);
+
+    // Returns true if queue commands may need to be batched. This is only a hint; callers must confirm it by calling
+    // MustBatchCmd() while holding m_batchedCmdsLock.
+    bool MayBatchCmd() const { return m_stalled || m_asyncSubmit; }
+
+    // Returns true if queue commands must be batched to preserve ordering. Must be called with m_batchedCmdsLock held.
+    bool MustBatchCmd() const
+        { return m_stalled || (m_asyncSubmit && (m_asyncCmdInFlight || (m_batchedCmds.NumElements() > 0))); }
+
+    static void SubmitThreadFunc(void* pParameter);
+    void ProcessAsyncCmds();
+    Result TakeAsyncSubmitResult();
+
     bool IsCmdDumpEnabled() const;
     Result OpenCommandDumpFile(
         const MultiSubmitInfo&      submitInfo,
@@ -441,6 +460,24 @@ private:
     Util::Deque<BatchedQueueCmdData, Platform>  m_batchedCmds;
     Util::Mutex                                 m_batchedCmdsLock;
 
+    // Batched commands own copies of their array arguments. Those allocations are recycled through this small cache
+    // so that a Queue which stays stalled for a long time doesn't hit the heap on every batched call. Protected by
+    // m_batchedCmdsLock.
+    static constexpr uint32 MaxCachedBatchedCmdMem = 8;
+
+    void*   m_pBatchedCmdMemCache[MaxCachedBatchedCmdMem];
+    uint32  m_batchedCmdMemCacheCount;
+
+    // When the AsyncQueueSubmission setting is enabled, submissions are always batched and m_submitThread performs
+    // the OS submissions. Other queue commands are only batched while older commands are still pending.
+    bool             m_asyncSubmit;
+    bool             m_asyncCmdInFlight;  // m_submitThread is executing a command without m_batchedCmdsLock.
+    Result           m_asyncSubmitResult; // First error reported by m_submitThread, returned (and cleared) by the
+                                          // next Submit() or WaitIdle().
+    volatile bool    m_submitThreadEnd;   // Tells m_submitThread to exit once it has drained the batched commands.
+    Util::Semaphore  m_submitThreadNotify;
+    Util::Thread     m_submitThread;
+
     // Each queue must register itself with its device and engine so that they can manage their internal lists.
     Util::IntrusiveListNode<Queue>              m_deviceMembershipNode;
 
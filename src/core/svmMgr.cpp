@@ -26,7 +26,7 @@
 #include "core/device.h"
 #include "core/platform.h"
 #include "core/svmMgr.h"
-#include "palBestFitAllocatorImpl.h"
+#include "palTlsfAllocatorImpl.h"
 
 using namespace Util;
 
@@ -134,7 +134,7 @@ Result SvmMgr::Init(
     if (result == Result::Success)
     {
         // Create and initialize the suballocator
-        m_pSubAllocator = PAL_NEW(BestFitAllocator<Platform>, pPlatform, AllocInternal)
+        m_pSubAllocator = PAL_NEW(TlsfAllocator<Platform>, pPlatform, AllocInternal)
                                 (pPlatform, m_vaSize, memProps.fragmentSize);
         if (m_pSubAllocator != nullptr)
         {
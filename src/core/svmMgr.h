@@ -26,7 +26,7 @@
 #pragma once
 
 #include "palMutex.h"
-#include "palBestFitAllocator.h"
+#include "palTlsfAllocator.h"
 
 namespace Pal
 {
@@ -36,7 +36,7 @@ class  Platform;
 struct VaRangeInfo;
 
 // =====================================================================================================================
-// SvmMgr provides a clean interface between PAL and the BestFitAllocator, which is used to allocate and free GPU
+// SvmMgr provides a clean interface between PAL and the TlsfAllocator, which is used to allocate and free GPU
 // virtual address space for SVM allocations on Windows and Linux platforms.
 // This GPU virtual address is shared with CPU.
 //
@@ -62,7 +62,7 @@ private:
     gpusize      m_vaStart;
     gpusize      m_vaSize;
 
-    Util::BestFitAllocator<Platform>* m_pSubAllocator;  // Suballocator used for the suballocation
+    Util::TlsfAllocator<Platform>* m_pSubAllocator;     // Suballocator used for the suballocation
 
     Util::Mutex  m_allocFreeVaLock;                     // Mutex protecting allocation and free of SVM va
 
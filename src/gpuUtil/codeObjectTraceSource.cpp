@@ -31,10 +31,13 @@
 #include "palVectorImpl.h"
 #include "palHashSetImpl.h"
 #include "palCodeObjectTraceSource.h"
+#include "palDbgPrint.h"
+#include "util/ddStructuredReader.h"
 
 using namespace Pal;
 using namespace Util;
 using namespace GpuUtil::TraceChunk;
+using DevDriver::StructuredValue;
 
 constexpr uint32 DefaultDeviceIndex = 0;
 
@@ -46,43 +49,76 @@ CodeObjectTraceSource::CodeObjectTraceSource(
     IPlatform* pPlatform)
     :
     m_pPlatform(pPlatform),
-    m_codeObjectRecords(pPlatform),
+    m_shards{ pPlatform, pPlatform, pPlatform, pPlatform, pPlatform, pPlatform, pPlatform, pPlatform },
     m_loadEventRecords(pPlatform),
     m_psoCorrelationRecords(pPlatform),
     m_coCorrelationRecords(pPlatform),
-    m_registeredPipelines(512, m_pPlatform),
     m_registeredApiHashes(512, m_pPlatform),
-    m_registeredCoHashes(512, m_pPlatform)
-
+    m_registeredCoHashes(512, m_pPlatform),
+    m_codeObjectCacheDir{},
+    m_traceIndex(0)
 {
+    static_assert(IsPowerOfTwo(NumCodeObjectShards), "GetShard() requires a power of two number of shards!");
 }
 
 // =====================================================================================================================
 CodeObjectTraceSource::~CodeObjectTraceSource()
 {
-    for (auto* pRecord : m_codeObjectRecords)
+    for (CodeObjectShard& shard : m_shards)
     {
-        PAL_FREE(pRecord, m_pPlatform);
+        for (auto* pRecord : shard.records)
+        {
+            PAL_FREE(pRecord, m_pPlatform);
+        }
+        shard.records.Clear();
+        shard.registeredPipelines.Reset();
     }
-    m_codeObjectRecords.Clear();
     m_loadEventRecords.Clear();
     m_psoCorrelationRecords.Clear();
     m_coCorrelationRecords.Clear();
-    m_registeredPipelines.Reset();
     m_registeredApiHashes.Reset();
     m_registeredCoHashes.Reset();
 }
 
+// =====================================================================================================================
+void CodeObjectTraceSource::OnConfigUpdated(
+    StructuredValue* pJsonConfig)
+{
+    StructuredValue value;
+
+    // Optional directory used to share code objects between traces. An empty string disables it.
+    if (pJsonConfig->GetValueByKey("codeObjectCacheDir", &value))
+    {
+        if (value.GetStringCopy(m_codeObjectCacheDir) == false)
+        {
+            m_codeObjectCacheDir[0] = '\0';
+        }
+    }
+}
+
 // =====================================================================================================================
 void CodeObjectTraceSource::OnTraceFinished()
 {
-    Result result = Result::Success;
+    Result            result = Result::Success;
+    CodeObjectRefList refs(m_pPlatform);
+
+    m_traceIndex++;
+
+    for (CodeObjectShard& shard : m_shards)
+    {
+        shard.lock.LockForRead();
+    }
+    m_loadEventLock.LockForRead();
+    m_correlationLock.LockForRead();
 
-    m_registerPipelineLock.LockForRead();
+    if (result == Result::Success)
+    {
+        result = WriteCodeObjectChunks(&refs);
+    }
 
     if (result == Result::Success)
     {
-        result = WriteCodeObjectChunks();
+        result = WriteCodeObjectRefChunk(refs);
     }
 
     if (result == Result::Success)
@@ -100,41 +136,156 @@ void CodeObjectTraceSource::OnTraceFinished()
         result = WriteCoCorrelationChunk();
     }
 
-    m_registerPipelineLock.UnlockForRead();
+    m_correlationLock.UnlockForRead();
+    m_loadEventLock.UnlockForRead();
+    for (CodeObjectShard& shard : m_shards)
+    {
+        shard.lock.UnlockForRead();
+    }
 }
 
 // =====================================================================================================================
-// Writes out a "CodeObject" chunk for each code object cached during the trace.
-Result CodeObjectTraceSource::WriteCodeObjectChunks()
+// Builds the path of the file which holds the given code object in the code object cache directory.
+void CodeObjectTraceSource::GetCodeObjectCachePath(
+    const CodeObjectDatabaseRecord& record,
+    char*                           pPath,
+    size_t                          pathSize
+    ) const
 {
-    Result result = Result::Success;
+    Snprintf(pPath,
+             pathSize,
+             "%s%c%016llX%016llX.co",
+             m_codeObjectCacheDir,
+             PathSep,
+             static_cast<unsigned long long>(record.codeObjectHash.upper),
+             static_cast<unsigned long long>(record.codeObjectHash.lower));
+}
+
+// =====================================================================================================================
+// Returns true if the code object cache directory already holds a complete copy of this record's code object. A file
+// of the wrong size is left over from an interrupted export and will be overwritten. The result is cached for the
+// rest of the current trace only.
+bool CodeObjectTraceSource::IsCodeObjectExported(
+    CodeObjectDatabaseRecord* pRecord
+    ) const
+{
+    if (pRecord->exportedTrace != m_traceIndex)
+    {
+        char path[MaxPathStrLen];
+        GetCodeObjectCachePath(*pRecord, path, sizeof(path));
+
+        const bool exists = File::Exists(path) && (File::GetFileSize(path) == pRecord->recordSize);
+
+        pRecord->exportedTrace = exists ? m_traceIndex : 0;
+    }
+
+    return (pRecord->exportedTrace == m_traceIndex);
+}
+
+// =====================================================================================================================
+// Writes this record's code object into the code object cache directory so later traces can reference it by hash.
+// Failures are not fatal: the code object has already been embedded in the current trace.
+void CodeObjectTraceSource::ExportCodeObject(
+    CodeObjectDatabaseRecord* pRecord
+    ) const
+{
+    char path[MaxPathStrLen];
+    GetCodeObjectCachePath(*pRecord, path, sizeof(path));
+
+    File   file;
+    Result result = file.Open(path, FileAccessWrite | FileAccessBinary);
+
+    if (result == Result::Success)
+    {
+        result = file.Write(VoidPtrInc(pRecord, sizeof(CodeObjectDatabaseRecord)), pRecord->recordSize);
+        file.Close();
+    }
+
+    pRecord->exportedTrace = (result == Result::Success) ? m_traceIndex : 0;
+}
+
+// =====================================================================================================================
+// Writes out a "CodeObject" chunk for each code object cached during the trace. If a code object cache directory is
+// configured, code objects which were exported by an earlier trace are skipped and their hashes are added to pRefs.
+Result CodeObjectTraceSource::WriteCodeObjectChunks(
+    CodeObjectRefList* pRefs)
+{
+    Result     result      = Result::Success;
+    const bool useCacheDir = (m_codeObjectCacheDir[0] != '\0');
 
     // Emit "CodeObject" chunks...
-    for (auto it = m_codeObjectRecords.Begin();
-         it.IsValid() && (result == Result::Success);
-         it.Next())
+    for (uint32 shardIdx = 0; (shardIdx < NumCodeObjectShards) && (result == Result::Success); shardIdx++)
     {
-        const CodeObjectDatabaseRecord* pRecord = it.Get();
-        const void* pCodeObjectBlob = VoidPtrInc(pRecord, sizeof(CodeObjectDatabaseRecord));
+        for (auto it = m_shards[shardIdx].records.Begin();
+             it.IsValid() && (result == Result::Success);
+             it.Next())
+        {
+            CodeObjectDatabaseRecord* pRecord = it.Get();
 
-        CodeObjectHeader header = {
-            .pciId              = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
-            .codeObjectHash     =
+            if (useCacheDir && IsCodeObjectExported(pRecord))
             {
-                .lower          = pRecord->codeObjectHash.lower,
-                .upper          = pRecord->codeObjectHash.upper
+                result = pRefs->PushBack(pRecord->codeObjectHash);
             }
+            else
+            {
+                const void* pCodeObjectBlob = VoidPtrInc(pRecord, sizeof(CodeObjectDatabaseRecord));
+
+                CodeObjectHeader header = {
+                    .pciId              = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
+                    .codeObjectHash     =
+                    {
+                        .lower          = pRecord->codeObjectHash.lower,
+                        .upper          = pRecord->codeObjectHash.upper
+                    }
+                };
+
+                TraceChunkInfo info    = {
+                    .version           = CodeObjectChunkVersion,
+                    .pHeader           = &header,
+                    .headerSize        = sizeof(CodeObjectHeader),
+                    .pData             = pCodeObjectBlob,
+                    .dataSize          = pRecord->recordSize,
+                    .enableCompression = false
+                };
+                memcpy(info.id, CodeObjectChunkId, TextIdentifierSize);
+
+                result = m_pPlatform->GetTraceSession()->WriteDataChunk(this, info);
+
+                if ((result == Result::Success) && useCacheDir)
+                {
+                    ExportCodeObject(pRecord);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes out a "CORef" chunk. This chunk lists the code objects which WriteCodeObjectChunks() skipped because they
+// were already present in the code object cache directory.
+Result CodeObjectTraceSource::WriteCodeObjectRefChunk(
+    const CodeObjectRefList& refs)
+{
+    Result result = Result::Success;
+
+    if (refs.NumElements() > 0)
+    {
+        CodeObjectRefHeader header = {
+            .pciId = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
+            .count = static_cast<uint32>(refs.NumElements())
         };
 
         TraceChunkInfo info    = {
-            .version           = CodeObjectChunkVersion,
+            .version           = CodeObjectRefChunkVersion,
             .pHeader           = &header,
-            .headerSize        = sizeof(CodeObjectHeader),
-            .pData             = pCodeObjectBlob,
-            .dataSize          = pRecord->recordSize,
+            .headerSize        = sizeof(header),
+            .pData             = refs.Data(),
+            .dataSize          = static_cast<int64>(sizeof(ShaderHash) * refs.NumElements()),
             .enableCompression = false
         };
-        memcpy(info.id, CodeObjectChunkId, TextIdentifierSize);
+        memcpy(info.id, CodeObjectRefChunkId, TextIdentifierSize);
 
         result = m_pPlatform->GetTraceSession()->WriteDataChunk(this, info);
     }
@@ -275,9 +426,9 @@ Result CodeObjectTraceSource::AddCodeObjectLoadEvent(
             .timestamp      = static_cast<uint64>(GetPerfCpuTime())
         };
 
-        m_registerPipelineLock.LockForWrite();
+        m_loadEventLock.LockForWrite();
         result = m_loadEventRecords.PushBack(record);
-        m_registerPipelineLock.UnlockForWrite();
+        m_loadEventLock.UnlockForWrite();
     }
 
     return result;
@@ -318,9 +469,9 @@ Result CodeObjectTraceSource::AddCodeObjectLoadEvent(
             .timestamp      = static_cast<uint64>(GetPerfCpuTime())
         };
 
-        m_registerPipelineLock.LockForWrite();
+        m_loadEventLock.LockForWrite();
         result = m_loadEventRecords.PushBack(record);
-        m_registerPipelineLock.UnlockForWrite();
+        m_loadEventLock.UnlockForWrite();
     }
 
     return result;
@@ -343,9 +494,75 @@ Result CodeObjectTraceSource::AddCodeObjectLoadEvent(
         .timestamp      = static_cast<uint64>(GetPerfCpuTime())
     };
 
-    m_registerPipelineLock.LockForWrite();
+    m_loadEventLock.LockForWrite();
     Result result = m_loadEventRecords.PushBack(record);
-    m_registerPipelineLock.UnlockForWrite();
+    m_loadEventLock.UnlockForWrite();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Records a mapping of an API hash to an internal pipeline hash, unless the same pair was recorded before.
+Result CodeObjectTraceSource::AddPsoCorrelation(
+    uint64              apiHash,
+    const PipelineHash& internalPipelineHash,
+    uint64              uniqueHash)
+{
+    Result result = Result::Success;
+
+    m_correlationLock.LockForWrite();
+    if (m_registeredApiHashes.Contains(uniqueHash) == false)
+    {
+        TraceChunk::PsoCorrelation record = {
+            .pciId                = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
+            .apiPsoHash           = apiHash,
+            .internalPipelineHash = internalPipelineHash,
+            .apiLevelObjectName   = { '\0' } // unused
+        };
+        result = m_psoCorrelationRecords.PushBack(record);
+
+        if (result == Result::Success)
+        {
+            result = m_registeredApiHashes.Insert(uniqueHash);
+        }
+    }
+    m_correlationLock.UnlockForWrite();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Claims a code object hash for the caller. Returns AlreadyExists if the code object was registered before, in which
+// case the caller must not store another copy of it.
+Result CodeObjectTraceSource::RegisterCodeObjectHash(
+    uint64 hash)
+{
+    CodeObjectShard* pShard = GetShard(hash);
+
+    pShard->lock.LockForWrite();
+    const Result result = pShard->registeredPipelines.Contains(hash) ? Result::AlreadyExists
+                                                                     : pShard->registeredPipelines.Insert(hash);
+    pShard->lock.UnlockForWrite();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Stores a code object record in the shard which owns its hash. Takes ownership of the record.
+Result CodeObjectTraceSource::AddCodeObjectRecord(
+    uint64 hash,
+    void*  pCodeObjectRecord)
+{
+    CodeObjectShard* pShard = GetShard(hash);
+
+    pShard->lock.LockForWrite();
+    Result result = pShard->records.PushBack(static_cast<CodeObjectDatabaseRecord*>(pCodeObjectRecord));
+    pShard->lock.UnlockForWrite();
+
+    if (result != Result::Success)
+    {
+        PAL_FREE(pCodeObjectRecord, m_pPlatform);
+    }
 
     return result;
 }
@@ -362,7 +579,6 @@ Result CodeObjectTraceSource::RegisterLibrary(
 
     const LibraryInfo& libraryInfo = pLibrary->GetInfo();
 
-    m_registerPipelineLock.LockForWrite();
     if ((result == Result::Success) && (clientInfo.apiHash != 0))
     {
         MetroHash::Hash tempHash = { };
@@ -372,34 +588,17 @@ Result CodeObjectTraceSource::RegisterLibrary(
         hasher.Update(libraryInfo.internalLibraryHash);
         hasher.Finalize(tempHash.bytes);
 
-        const uint64 uniqueHash = MetroHash::Compact64(&tempHash);
-
-        if (m_registeredApiHashes.Contains(uniqueHash) == false)
-        {
-            // Record a mapping of API hash -> internal library hash so they can be correlated.
-            TraceChunk::PsoCorrelation record = {
-                .pciId                = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
-                .apiPsoHash           = clientInfo.apiHash,
-                .internalPipelineHash = libraryInfo.internalLibraryHash,
-                .apiLevelObjectName   = { '\0' } // unused
-            };
-            result = m_psoCorrelationRecords.PushBack(record);
-
-            if (result == Result::Success)
-            {
-                result = m_registeredApiHashes.Insert(uniqueHash);
-            }
-        }
+        // Record a mapping of API hash -> internal library hash so they can be correlated.
+        result = AddPsoCorrelation(clientInfo.apiHash,
+                                   libraryInfo.internalLibraryHash,
+                                   MetroHash::Compact64(&tempHash));
     }
 
     // Record the compiled hash, if it hasn't been seen before
     if (result == Result::Success)
     {
-        result = m_registeredPipelines.Contains(libraryInfo.internalLibraryHash.unique)
-               ? Result::AlreadyExists
-               : m_registeredPipelines.Insert(libraryInfo.internalLibraryHash.unique);
+        result = RegisterCodeObjectHash(libraryInfo.internalLibraryHash.unique);
     }
-    m_registerPipelineLock.UnlockForWrite();
 
     // Store a copy of the code object & associated metadata
     if (result == Result::Success)
@@ -443,9 +642,7 @@ Result CodeObjectTraceSource::RegisterLibrary(
 
         if (result == Result::Success)
         {
-            m_registerPipelineLock.LockForWrite();
-            m_codeObjectRecords.PushBack(static_cast<CodeObjectDatabaseRecord*>(pCodeObjectRecord));
-            m_registerPipelineLock.UnlockForWrite();
+            result = AddCodeObjectRecord(libraryInfo.internalLibraryHash.unique, pCodeObjectRecord);
         }
     }
 
@@ -517,8 +714,6 @@ Result CodeObjectTraceSource::RegisterSinglePipeline(
     // Even if the pipeline was already previously encountered, we still want to record every time it gets loaded.
     Result result = AddCodeObjectLoadEvent(pPipeline, CodeObjectLoadEventType::LoadToGpuMemory);
 
-    m_registerPipelineLock.LockForWrite();
-
     if ((result == Result::Success) && (clientInfo.apiPsoHash != 0))
     {
         MetroHash::Hash tempHash = { };
@@ -528,38 +723,22 @@ Result CodeObjectTraceSource::RegisterSinglePipeline(
         hasher.Update(pipeInfo.internalPipelineHash);
         hasher.Finalize(tempHash.bytes);
 
-        const uint64 uniqueHash = MetroHash::Compact64(&tempHash);
-
-        if (m_registeredApiHashes.Contains(uniqueHash) == false)
-        {
-            // Record a mapping of API PSO hash -> internal pipeline hash so they can be correlated.
-            TraceChunk::PsoCorrelation record = {
-                .pciId                = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
-                .apiPsoHash           = clientInfo.apiPsoHash,
-                .internalPipelineHash = pipeInfo.internalPipelineHash,
-                .apiLevelObjectName   = { '\0' } // unused
-            };
-            result = m_psoCorrelationRecords.PushBack(record);
-
-            if (result == Result::Success)
-            {
-                result = m_registeredApiHashes.Insert(uniqueHash);
-            }
-        }
+        // Record a mapping of API PSO hash -> internal pipeline hash so they can be correlated.
+        result = AddPsoCorrelation(clientInfo.apiPsoHash,
+                                   pipeInfo.internalPipelineHash,
+                                   MetroHash::Compact64(&tempHash));
     }
 
+    const uint64 hash = (pipeInfo.internalPipelineHash.unique == pipeInfo.internalPipelineHash.stable) ?
+        pipeInfo.internalPipelineHash.unique :
+        (pipeInfo.internalPipelineHash.unique ^ pipeInfo.internalPipelineHash.stable);
+
     // Record the compiled hash, if it hasn't been seen before
     if (result == Result::Success)
     {
-        const uint64 hash = (pipeInfo.internalPipelineHash.unique == pipeInfo.internalPipelineHash.stable) ?
-            pipeInfo.internalPipelineHash.unique :
-            (pipeInfo.internalPipelineHash.unique ^ pipeInfo.internalPipelineHash.stable);
-
-        result = m_registeredPipelines.Contains(hash) ? Result::AlreadyExists : m_registeredPipelines.Insert(hash);
+        result = RegisterCodeObjectHash(hash);
     }
 
-    m_registerPipelineLock.UnlockForWrite();
-
     // Store a copy of the code object & associated metadata
     if (result == Result::Success)
     {
@@ -604,9 +783,7 @@ Result CodeObjectTraceSource::RegisterSinglePipeline(
 
         if (result == Result::Success)
         {
-            m_registerPipelineLock.LockForWrite();
-            m_codeObjectRecords.PushBack(static_cast<CodeObjectDatabaseRecord*>(pCodeObjectRecord));
-            m_registerPipelineLock.UnlockForWrite();
+            result = AddCodeObjectRecord(hash, pCodeObjectRecord);
         }
     }
 
@@ -659,7 +836,6 @@ Result CodeObjectTraceSource::RegisterElfBinary(
     // Even if the library was already previously encountered, we still want to record every time it gets loaded.
     Result result = AddCodeObjectLoadEvent(elfBinaryInfo, CodeObjectLoadEventType::LoadToGpuMemory);
 
-    m_registerPipelineLock.LockForWrite();
     if ((result == Result::Success) && (elfBinaryInfo.originalHash != 0))
     {
         MetroHash::Hash tempHash = {};
@@ -671,35 +847,17 @@ Result CodeObjectTraceSource::RegisterElfBinary(
 
         const uint64 uniqueHash = MetroHash::Compact64(&tempHash);
 
-        if (m_registeredApiHashes.Contains(uniqueHash) == false)
-        {
-            // Record a mapping of API hash -> internal library hash so they can be correlated.
-            PsoCorrelation record     = {
-                .pciId                = m_pPlatform->GetPciId(DefaultDeviceIndex).u32All,
-                .apiPsoHash           = elfBinaryInfo.originalHash,
-                .internalPipelineHash =
-                {
-                    .stable           = elfBinaryInfo.compiledHash,
-                    .unique           = uniqueHash
-                }
-            };
-            result = m_psoCorrelationRecords.PushBack(record);
-
-            if (result == Result::Success)
-            {
-                result = m_registeredApiHashes.Insert(uniqueHash);
-            }
-        }
+        // Record a mapping of API hash -> internal library hash so they can be correlated.
+        result = AddPsoCorrelation(elfBinaryInfo.originalHash,
+                                   { .stable = elfBinaryInfo.compiledHash, .unique = uniqueHash },
+                                   uniqueHash);
     }
 
     // Record the compiled hash, if it hasn't been seen before
     if (result == Result::Success)
     {
-        result = m_registeredPipelines.Contains(elfBinaryInfo.compiledHash)
-               ? Result::AlreadyExists
-               : m_registeredPipelines.Insert(elfBinaryInfo.compiledHash);
+        result = RegisterCodeObjectHash(elfBinaryInfo.compiledHash);
     }
-    m_registerPipelineLock.UnlockForWrite();
 
     // Store a copy of the code object & associated metadata
     if (result == Result::Success)
@@ -735,9 +893,7 @@ Result CodeObjectTraceSource::RegisterElfBinary(
 
         if (result == Result::Success)
         {
-            m_registerPipelineLock.LockForWrite();
-            m_codeObjectRecords.PushBack(static_cast<CodeObjectDatabaseRecord*>(pCodeObjectRecord));
-            m_registerPipelineLock.UnlockForWrite();
+            result = AddCodeObjectRecord(elfBinaryInfo.compiledHash, pCodeObjectRecord);
         }
     }
 
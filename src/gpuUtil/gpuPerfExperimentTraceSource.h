@@ -120,6 +120,9 @@ public:
 
     virtual Pal::uint32 GetVersion() const override { return GpuPerfExpTraceSourceVersion; }
 
+    // Only reads back this source's own GpaSession, so it can be finalized alongside other sources.
+    virtual bool SupportsConcurrentFinish() const override { return true; }
+
 private:
     bool TestSeMask(
         Pal::uint32 seMask,
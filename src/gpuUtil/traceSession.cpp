@@ -27,12 +27,15 @@
 
 #include "palTraceSession.h"
 #include "palHashMapImpl.h"
+#include "palThread.h"
 #include "palVectorImpl.h"
 #include "core/imported/rdf/rdf/inc/amdrdf.h"
 #include "uberTraceService.h"
 #include "util/ddStructuredReader.h"
 #include "util/ddJsonWriter.h"
 
+#include <atomic>
+
 using namespace Pal;
 using DevDriver::StructuredValue;
 
@@ -95,7 +98,8 @@ TraceSession::TraceSession(
     m_tracingEnabled(false),
     m_pConfigData(nullptr),
     m_configDataSize(0),
-    m_cancelingTrace(false)
+    m_cancelingTrace(false),
+    m_maxFinishThreads(0)
 {
 }
 
@@ -793,25 +797,97 @@ Result TraceSession::WriteDataChunk(
             .version     = info.version
         };
         memcpy(currentChunkInfo.identifier, info.id, TextIdentifierSize);
-        Util::RWLockAuto<Util::RWLock::ReadWrite> chunkAppendLock(&m_chunkAppendLock);
 
-        // Append the incoming chunk to the data stream
-        result = rdfChunkFileWriterWriteChunk(m_pChunkFileWriter,
-                                              &currentChunkInfo,
+        if (info.enableCompression)
+        {
+            // Compression is the expensive part of writing a chunk, so do it before taking the append lock.  This lets
+            // trace sources which are finalized concurrently compress their chunks in parallel.
+            int64 bufferSize = 0;
+            result = rdfGetCompressedChunkDataBound(currentChunkInfo.compression, info.dataSize, &bufferSize);
+
+            void* pCompressed = nullptr;
+            if (result == rdfResult::rdfResultOk)
+            {
+                pCompressed = PAL_MALLOC(static_cast<size_t>(Util::Max<int64>(bufferSize, 1)),
+                                         m_pPlatform,
+                                         Util::AllocInternalTemp);
+                result      = (pCompressed != nullptr) ? rdfResult::rdfResultOk : rdfResult::rdfResultError;
+            }
+
+            int64 compressedSize = 0;
+            if (result == rdfResult::rdfResultOk)
+            {
+                result = rdfCompressChunkData(currentChunkInfo.compression,
                                               info.dataSize,
                                               info.pData,
-                                              &m_currentChunkIndex);
+                                              bufferSize,
+                                              pCompressed,
+                                              &compressedSize);
+            }
+
+            if (result == rdfResult::rdfResultOk)
+            {
+                Util::RWLockAuto<Util::RWLock::ReadWrite> chunkAppendLock(&m_chunkAppendLock);
+
+                // Append the compressed chunk to the data stream
+                result = rdfChunkFileWriterWriteCompressedChunk(m_pChunkFileWriter,
+                                                                &currentChunkInfo,
+                                                                compressedSize,
+                                                                pCompressed,
+                                                                info.dataSize,
+                                                                &m_currentChunkIndex);
+            }
+
+            PAL_FREE(pCompressed, m_pPlatform);
+        }
+        else
+        {
+            Util::RWLockAuto<Util::RWLock::ReadWrite> chunkAppendLock(&m_chunkAppendLock);
+
+            // Append the incoming chunk to the data stream
+            result = rdfChunkFileWriterWriteChunk(m_pChunkFileWriter,
+                                                  &currentChunkInfo,
+                                                  info.dataSize,
+                                                  info.pData,
+                                                  &m_currentChunkIndex);
+        }
     }
 
     return RdfResultToPalResult(result);
 }
 
+// =====================================================================================================================
+// Work shared between FinishTrace and its worker threads. Each participant repeatedly claims the next unfinished
+// source.
+struct ConcurrentFinishState
+{
+    ITraceSource* const* ppSources;
+    uint32               numSources;
+    std::atomic<uint32>  nextSource;
+};
+
+// =====================================================================================================================
+// Calls OnTraceFinished on trace sources from the shared list until all of them have been claimed.
+void TraceSession::FinishTraceWorker(
+    void* pParameter)
+{
+    ConcurrentFinishState* pState = static_cast<ConcurrentFinishState*>(pParameter);
+
+    for (uint32 idx = pState->nextSource++; idx < pState->numSources; idx = pState->nextSource++)
+    {
+        pState->ppSources[idx]->OnTraceFinished(); // Writes data into TraceSession
+    }
+}
+
 // =====================================================================================================================
 void TraceSession::FinishTrace()
 {
     Util::RWLockAuto<Util::RWLock::ReadOnly> traceSourceLock(&m_registerTraceSourceLock);
 
-    // Notify all requested trace sources that the trace has finished
+    TraceSourcesVec concurrentSources(m_pPlatform);
+
+    // Notify all requested trace sources that the trace has finished. Sources which can be finalized concurrently are
+    // deferred so they can be handed out to worker threads below.
     const StructuredValue traceSources = m_pReader->GetRoot()["sources"];
     for (uint32 i = 0; i < traceSources.GetArrayLength(); i++)
     {
@@ -822,7 +898,12 @@ void TraceSession::FinishTrace()
             {
                 if (TraceSourceNameEquals(pSource, pName))
                 {
-                    pSource->OnTraceFinished(); // Writes data into TraceSession
+                    if ((m_maxFinishThreads == 0)                    ||
+                        (pSource->SupportsConcurrentFinish() == false) ||
+                        (concurrentSources.PushBack(pSource) != Result::Success))
+                    {
+                        pSource->OnTraceFinished(); // Writes data into TraceSession
+                    }
 
                     if (pSource->AllowMultipleInstances() == false)
                     {
@@ -832,6 +913,35 @@ void TraceSession::FinishTrace()
             }
         }
     }
+
+    if (concurrentSources.NumElements() > 0)
+    {
+        ConcurrentFinishState state = {};
+        state.ppSources  = &concurrentSources[0];
+        state.numSources = concurrentSources.NumElements();
+        state.nextSource = 0;
+
+        // The calling thread also claims sources, so one fewer worker than sources is enough to finish them all in
+        // parallel. If a worker thread cannot be started, its share of the sources is picked up by the others.
+        const uint32 numThreads = Util::Min(m_maxFinishThreads, state.numSources - 1);
+
+        Util::Thread workers[MaxFinishThreads];
+        for (uint32 idx = 0; idx < numThreads; idx++)
+        {
+            if (workers[idx].Begin(&FinishTraceWorker, &state) != Result::Success)
+            {
+                break;
+            }
+        }
+
+        FinishTraceWorker(&state);
+
+        // Wait for every worker to finish writing its chunks before the trace can be collected.
+        for (uint32 idx = 0; idx < numThreads; idx++)
+        {
+            workers[idx].Join();
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -26,18 +26,83 @@
 #include "palMutex.h"
 #include "palSysMemory.h"
 #include <errno.h>
+#include <linux/futex.h>
 #include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace Util
 {
 
+// Upper bound on the number of spins a contended Mutex::Lock() makes before sleeping.
+constexpr uint32 MutexMaxSpins  = 100;
+
+// Number of times a contended RWLock polls its state before sleeping.
+constexpr uint32 RWLockSpinCount = 100;
+
+// =====================================================================================================================
+// Tells the CPU that we are in a spin-wait loop.
+static void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// =====================================================================================================================
+// Sleeps until the futex word is woken, unless it no longer holds expectedValue.  Spurious wakeups are possible.
+static void FutexWait(
+    std::atomic<uint32>* pWord,
+    uint32               expectedValue)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32*>(pWord), FUTEX_WAIT_PRIVATE, expectedValue, nullptr, nullptr, 0);
+}
+
+// =====================================================================================================================
+// Wakes up to count threads sleeping on the futex word.  Returns the number of threads woken.
+static int32 FutexWake(
+    std::atomic<uint32>* pWord,
+    int32                count)
+{
+    return static_cast<int32>(
+        syscall(SYS_futex, reinterpret_cast<uint32*>(pWord), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0));
+}
+
 // =====================================================================================================================
-// Acquires the mutex if it is not contended.  If it is contended, waits for the mutex to become available, then
-// acquires it.
+// Acquires the mutex if it is not contended.  If it is contended, spins for a while in case the owner is about to
+// release it, then waits for the mutex to become available and acquires it.
+//
+// The pthread mutex already has a futex fast path, but it sleeps as soon as the mutex is contended.  The spin limit
+// adapts to how long this mutex is usually held, like glibc's PTHREAD_MUTEX_ADAPTIVE_NP, which is not portable.
 void Mutex::Lock()
 {
-    const int ret = pthread_mutex_lock(&m_osMutex);
-    PAL_ASSERT(ret == 0);
+    if (pthread_mutex_trylock(&m_osMutex) != 0)
+    {
+        const uint32 estimate = m_spinEstimate.load(std::memory_order_relaxed);
+        const uint32 maxSpins = Min(MutexMaxSpins, (estimate * 2) + 10);
+
+        uint32 spins    = 0;
+        bool   acquired = false;
+
+        while ((acquired == false) && (spins < maxSpins))
+        {
+            CpuRelax();
+            spins++;
+            acquired = (pthread_mutex_trylock(&m_osMutex) == 0);
+        }
+
+        if (acquired == false)
+        {
+            const int ret = pthread_mutex_lock(&m_osMutex);
+            PAL_ASSERT(ret == 0);
+        }
+
+        // Move the estimate an eighth of the way towards this acquire's spin count.
+        m_spinEstimate.store(estimate + ((static_cast<int32>(spins) - static_cast<int32>(estimate)) / 8),
+                             std::memory_order_relaxed);
+    }
 }
 
 // =====================================================================================================================
@@ -59,13 +124,99 @@ void Mutex::Unlock()
     PAL_ASSERT(ret == 0);
 }
 
+// =====================================================================================================================
+// Returns true if a reader may take the lock in the given state.  Readers never enter while other readers are asleep:
+// that only happens right after a write unlock, and the unlocking thread is responsible for waking them.
+bool RWLock::IsReadLockable(
+    uint32 state
+    ) const
+{
+    const bool writerBlocks = (m_policy == Policy::PreferWriter) && ((state & WritersWaiting) != 0);
+
+    return ((state & LockedMask) < MaxReaders) && ((state & ReadersWaiting) == 0) && (writerBlocks == false);
+}
+
+// =====================================================================================================================
+// Polls the state for a while until a reader might make progress.  Returns the last state read.
+uint32 RWLock::SpinRead() const
+{
+    uint32 state = m_state.load(std::memory_order_relaxed);
+
+    for (uint32 spin = 0;
+         (spin < RWLockSpinCount) && ((state & LockedMask) == WriteLocked) && ((state & ~LockedMask) == 0);
+         ++spin)
+    {
+        CpuRelax();
+        state = m_state.load(std::memory_order_relaxed);
+    }
+
+    return state;
+}
+
+// =====================================================================================================================
+// Polls the state for a while until a writer might make progress.  Returns the last state read.
+uint32 RWLock::SpinWrite() const
+{
+    uint32 state = m_state.load(std::memory_order_relaxed);
+
+    for (uint32 spin = 0;
+         (spin < RWLockSpinCount) && ((state & LockedMask) != 0) && ((state & WritersWaiting) == 0);
+         ++spin)
+    {
+        CpuRelax();
+        state = m_state.load(std::memory_order_relaxed);
+    }
+
+    return state;
+}
+
 // =====================================================================================================================
 // Acquires a rw lock in readonly mode if it is not contended in readwrite mode.
 // If it is contended, wait for rw lock to become available, then enter it.
 void RWLock::LockForRead()
 {
-    const int ret = pthread_rwlock_rdlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    uint32 state = m_state.load(std::memory_order_relaxed);
+
+    if ((IsReadLockable(state) == false) ||
+        (m_state.compare_exchange_weak(state,
+                                       state + 1,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed) == false))
+    {
+        LockForReadContended();
+    }
+}
+
+// =====================================================================================================================
+void RWLock::LockForReadContended()
+{
+    uint32 state    = SpinRead();
+    bool   acquired = false;
+
+    while (acquired == false)
+    {
+        if (IsReadLockable(state))
+        {
+            acquired = m_state.compare_exchange_weak(state,
+                                                     state + 1,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed);
+        }
+        else if (((state & ReadersWaiting) == 0) &&
+                 (m_state.compare_exchange_weak(state,
+                                                state | ReadersWaiting,
+                                                std::memory_order_relaxed) == false))
+        {
+            // The state changed before we could flag ourselves as waiting; state now holds the new value.
+        }
+        else
+        {
+            PAL_ASSERT((state & LockedMask) != MaxReaders);
+
+            FutexWait(&m_state, state | ReadersWaiting);
+            state = SpinRead();
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -73,8 +224,57 @@ void RWLock::LockForRead()
 // If it is contended, wait for rw lock to become available, then enter it.
 void RWLock::LockForWrite()
 {
-    const int ret = pthread_rwlock_wrlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    uint32 state = 0;
+
+    if (m_state.compare_exchange_weak(state,
+                                      WriteLocked,
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed) == false)
+    {
+        LockForWriteContended();
+    }
+}
+
+// =====================================================================================================================
+void RWLock::LockForWriteContended()
+{
+    uint32 state    = SpinWrite();
+    uint32 keepBits = 0;  // Set to WritersWaiting once we have slept, since other writers may be asleep too.
+    bool   acquired = false;
+
+    while (acquired == false)
+    {
+        if ((state & LockedMask) == 0)
+        {
+            // Writers take an unlocked lock regardless of who is waiting.
+            acquired = m_state.compare_exchange_weak(state,
+                                                     state | WriteLocked | keepBits,
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed);
+        }
+        else if (((state & WritersWaiting) == 0) &&
+                 (m_state.compare_exchange_weak(state,
+                                                state | WritersWaiting,
+                                                std::memory_order_relaxed) == false))
+        {
+            // The state changed before we could flag ourselves as waiting; state now holds the new value.
+        }
+        else
+        {
+            keepBits = WritersWaiting;
+
+            // Read the notification counter before rechecking the state so that a wakeup between the two is not lost.
+            const uint32 notify = m_writerNotify.load(std::memory_order_acquire);
+
+            state = m_state.load(std::memory_order_relaxed);
+
+            if (((state & LockedMask) != 0) && ((state & WritersWaiting) != 0))
+            {
+                FutexWait(&m_writerNotify, notify);
+                state = SpinWrite();
+            }
+        }
+    }
 }
 
 // =====================================================================================================================
@@ -82,10 +282,18 @@ void RWLock::LockForWrite()
 // Does not wait for the rw lock to become available.
 bool RWLock::TryLockForRead()
 {
-    const int ret = pthread_rwlock_tryrdlock(&m_osRWLock);
-    PAL_ASSERT((ret == 0) || (ret == EBUSY));
-
-    return (ret == 0);
+    uint32 state    = m_state.load(std::memory_order_relaxed);
+    bool   acquired = false;
+
+    while ((acquired == false) && IsReadLockable(state))
+    {
+        acquired = m_state.compare_exchange_weak(state,
+                                                 state + 1,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed);
+    }
+
+    return acquired;
 }
 
 // =====================================================================================================================
@@ -93,26 +301,211 @@ bool RWLock::TryLockForRead()
 // Does not wait for the rw lock to become available.
 bool RWLock::TryLockForWrite()
 {
-    const int ret = pthread_rwlock_trywrlock(&m_osRWLock);
-    PAL_ASSERT((ret == 0) || (ret == EBUSY));
-
-    return (ret == 0);
+    uint32 state    = m_state.load(std::memory_order_relaxed);
+    bool   acquired = false;
+
+    while ((acquired == false) && ((state & LockedMask) == 0))
+    {
+        acquired = m_state.compare_exchange_weak(state,
+                                                 state | WriteLocked,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed);
+    }
+
+    return acquired;
 }
 
 // =====================================================================================================================
 // Release the rw lock which is previously contended.
 void RWLock::UnlockForRead()
 {
-    const int ret = pthread_rwlock_unlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    const uint32 state = m_state.fetch_sub(1, std::memory_order_release) - 1;
+
+    PAL_ASSERT((state & LockedMask) < MaxReaders);
+
+    // The last reader out hands the lock to a waiting writer.  Readers can only be asleep here if a writer is too.
+    if (((state & LockedMask) == 0) && ((state & WritersWaiting) != 0))
+    {
+        WakeWriterOrReaders(state);
+    }
 }
 
 // =====================================================================================================================
 // Release the rw lock which is previously contended.
 void RWLock::UnlockForWrite()
 {
-    const int ret = pthread_rwlock_unlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    const uint32 state = m_state.fetch_sub(WriteLocked, std::memory_order_release) - WriteLocked;
+
+    PAL_ASSERT((state & LockedMask) == 0);
+
+    if ((state & (ReadersWaiting | WritersWaiting)) != 0)
+    {
+        WakeWriterOrReaders(state);
+    }
+}
+
+// =====================================================================================================================
+// Called by the thread which just left an unlocked lock with waiters.  Writers are woken first; readers are woken once
+// no writer is left waiting.  If another thread takes the lock in the meantime, waking the waiters becomes its job.
+void RWLock::WakeWriterOrReaders(
+    uint32 state)
+{
+    PAL_ASSERT((state & LockedMask) == 0);
+
+    bool done = false;
+
+    if (state == WritersWaiting)
+    {
+        if (m_state.compare_exchange_strong(state, 0, std::memory_order_relaxed))
+        {
+            WakeWriter();
+            done = true;
+        }
+    }
+
+    if ((done == false) && (state == (ReadersWaiting | WritersWaiting)))
+    {
+        // Leave the readers asleep and wake a writer.  If no writer was actually asleep we cannot be sure that one
+        // will unlock later, so wake the readers too.
+        done = (m_state.compare_exchange_strong(state, ReadersWaiting, std::memory_order_relaxed) == false) ||
+               WakeWriter();
+        state = ReadersWaiting;
+    }
+
+    if ((done == false) && (state == ReadersWaiting))
+    {
+        if (m_state.compare_exchange_strong(state, 0, std::memory_order_relaxed))
+        {
+            FutexWake(&m_state, INT32_MAX);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Wakes one sleeping writer.  Returns true if a writer was woken.
+bool RWLock::WakeWriter()
+{
+    m_writerNotify.fetch_add(1, std::memory_order_release);
+
+    return (FutexWake(&m_writerNotify, 1) > 0);
+}
+
+// =====================================================================================================================
+// Returns the reader counter used by the calling thread.  Threads are dealt out round-robin, which keeps readers on
+// separate cache lines as long as there are no more reading threads than slots.  The slot must be stable for a thread
+// because the unlock has to decrement the counter the lock incremented.
+uint32 ReaderBiasedRWLock::ReaderSlotIndex()
+{
+    static std::atomic<uint32> s_nextSlot{ 0 };
+    static thread_local uint32 s_slot = s_nextSlot.fetch_add(1, std::memory_order_relaxed) % NumReaderSlots;
+
+    return s_slot;
+}
+
+// =====================================================================================================================
+bool ReaderBiasedRWLock::HasReaders() const
+{
+    bool hasReaders = false;
+
+    for (uint32 i = 0; (hasReaders == false) && (i < NumReaderSlots); ++i)
+    {
+        hasReaders = (m_readers[i].count.load(std::memory_order_seq_cst) != 0);
+    }
+
+    return hasReaders;
+}
+
+// =====================================================================================================================
+// Readers announce themselves in their slot and then check for a writer.  Writers do the opposite, so with sequentially
+// consistent ordering at least one of them sees the other.
+void ReaderBiasedRWLock::LockForRead()
+{
+    ReaderSlot*const pSlot = &m_readers[ReaderSlotIndex()];
+
+    pSlot->count.fetch_add(1, std::memory_order_seq_cst);
+
+    if (m_writerActive.load(std::memory_order_seq_cst))
+    {
+        // Back out and queue behind the writer on its lock.  Nobody can be holding it for write once we hold it for
+        // read, so it is safe to register in the slot again.
+        pSlot->count.fetch_sub(1, std::memory_order_release);
+
+        m_writerLock.LockForRead();
+        pSlot->count.fetch_add(1, std::memory_order_seq_cst);
+        m_writerLock.UnlockForRead();
+    }
+}
+
+// =====================================================================================================================
+bool ReaderBiasedRWLock::TryLockForRead()
+{
+    ReaderSlot*const pSlot = &m_readers[ReaderSlotIndex()];
+
+    pSlot->count.fetch_add(1, std::memory_order_seq_cst);
+
+    const bool acquired = (m_writerActive.load(std::memory_order_seq_cst) == false);
+
+    if (acquired == false)
+    {
+        pSlot->count.fetch_sub(1, std::memory_order_release);
+    }
+
+    return acquired;
+}
+
+// =====================================================================================================================
+void ReaderBiasedRWLock::UnlockForRead()
+{
+    const uint32 prevCount = m_readers[ReaderSlotIndex()].count.fetch_sub(1, std::memory_order_release);
+    PAL_ASSERT(prevCount != 0);
+}
+
+// =====================================================================================================================
+// Writers are expected to be rare, so a writer waits for the readers to drain by polling rather than making every
+// reader check for a sleeping writer.
+void ReaderBiasedRWLock::LockForWrite()
+{
+    m_writerLock.LockForWrite();
+    m_writerActive.store(true, std::memory_order_seq_cst);
+
+    for (uint32 spin = 0; HasReaders(); ++spin)
+    {
+        if (spin < RWLockSpinCount)
+        {
+            CpuRelax();
+        }
+        else
+        {
+            YieldThread();
+        }
+    }
+}
+
+// =====================================================================================================================
+bool ReaderBiasedRWLock::TryLockForWrite()
+{
+    bool acquired = m_writerLock.TryLockForWrite();
+
+    if (acquired)
+    {
+        m_writerActive.store(true, std::memory_order_seq_cst);
+
+        if (HasReaders())
+        {
+            m_writerActive.store(false, std::memory_order_relaxed);
+            m_writerLock.UnlockForWrite();
+            acquired = false;
+        }
+    }
+
+    return acquired;
+}
+
+// =====================================================================================================================
+void ReaderBiasedRWLock::UnlockForWrite()
+{
+    m_writerActive.store(false, std::memory_order_release);
+    m_writerLock.UnlockForWrite();
 }
 
 // =====================================================================================================================